@@ -0,0 +1,64 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "polk/auto_tiling.hpp"
+#include "polk/execution_policy_creator.hpp"
+
+using HostView3D =
+    Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+template <typename Policy>
+void runStencil(benchmark::State &state, Policy const &policy,
+                HostView3D const &in, HostView3D const &out) {
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "stencil", policy,
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          out(i, j, k) = (in(i - 1, j, k) + in(i + 1, j, k) + in(i, j - 1, k) +
+                          in(i, j + 1, k) + in(i, j, k - 1) + in(i, j, k + 1)) /
+                             6. -
+                         in(i, j, k);
+        });
+    Kokkos::fence();
+  }
+
+  std::int64_t const interior = state.range(0) - 2;
+  state.SetBytesProcessed(state.iterations() * interior * interior * interior *
+                          2 * sizeof(double));
+}
+
+void benchmarkStencilDefaultTiling(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  HostView3D in("in", size, size, size);
+  HostView3D out("out", size, size, size);
+
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::Range<3>({1, 1, 1},
+                                         {size - 1, size - 1, size - 1}))
+                    .with(Kokkos::DefaultHostExecutionSpace{})
+                    .getPolicy();
+
+  runStencil(state, policy, in, out);
+}
+
+BENCHMARK(benchmarkStencilDefaultTiling)->Arg(128)->Arg(256)->Arg(512);
+
+void benchmarkStencilAutoTiling(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  HostView3D in("in", size, size, size);
+  HostView3D out("out", size, size, size);
+
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::Range<3>({1, 1, 1},
+                                         {size - 1, size - 1, size - 1}))
+                    .with(polk::AutoTiling(2 * sizeof(double)))
+                    .with(Kokkos::DefaultHostExecutionSpace{})
+                    .getPolicy();
+
+  runStencil(state, policy, in, out);
+}
+
+BENCHMARK(benchmarkStencilAutoTiling)->Arg(128)->Arg(256)->Arg(512);
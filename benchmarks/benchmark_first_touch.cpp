@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/first_touch.hpp"
+#include "polk/parallel.hpp"
+
+template <typename ExecutionSpace>
+using View3D = Kokkos::View<double ***, typename ExecutionSpace::memory_space>;
+
+/**
+ * How the views are initialized before the kernel.
+ */
+enum class Initialization {
+  /**
+   * By a single host thread, all pages being placed on its memory.
+   */
+  serial,
+  /**
+   * By Kokkos on allocation, with its own single-dimensional mapping.
+   */
+  kokkos,
+  /**
+   * By `polk::first_touch`, with the mapping of the kernel.
+   */
+  polk,
+};
+
+/**
+ * Allocate a view and initialize it.
+ */
+template <typename ExecutionSpace, Initialization initialization,
+          typename ExecutionParameters>
+View3D<ExecutionSpace> createView(std::string const &label,
+                                  ExecutionSpace const &space,
+                                  ExecutionParameters const &parameters,
+                                  std::size_t const size) {
+  if constexpr (initialization == Initialization::kokkos) {
+    return View3D<ExecutionSpace>(Kokkos::view_alloc(space, label), size, size,
+                                  size);
+  } else {
+    View3D<ExecutionSpace> view(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, label), size,
+        size, size);
+    if constexpr (initialization == Initialization::serial) {
+      std::fill_n(view.data(), view.size(), 0.);
+    } else {
+      polk::first_touch(parameters, view);
+    }
+    return view;
+  }
+}
+
+// 3D STREAM triad, arguments are the size and the tile size of the outer
+// dimensions, the innermost dimension being untiled
+
+template <typename ExecutionSpace, Initialization initialization>
+void benchmarkTriadFirstTouch(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  std::size_t const tile = state.range(1);
+  ExecutionSpace const space;
+  double const scalar = 3.;
+
+  auto const parameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<3>({0, 0, 0}, {size, size, size}))
+          .with(polk::Tiling<3>({tile, tile, size}))
+          .with(space);
+  auto const a = createView<ExecutionSpace, initialization>("a", space,
+                                                            parameters, size);
+  auto const b = createView<ExecutionSpace, initialization>("b", space,
+                                                            parameters, size);
+  auto const c = createView<ExecutionSpace, initialization>("c", space,
+                                                            parameters, size);
+  space.fence();
+
+  auto const kernel = KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                                    std::int64_t const k) {
+    a(i, j, k) = b(i, j, k) + scalar * c(i, j, k);
+  };
+
+  polk::parallel_for("warm-up", parameters, kernel);
+  space.fence();
+
+  while (state.KeepRunning()) {
+    polk::parallel_for("triad", parameters, kernel);
+    space.fence();
+  }
+
+  state.SetBytesProcessed(state.iterations() * 3 * size * size * size *
+                          sizeof(double));
+}
+
+#define POLK_BENCHMARK_FIRST_TOUCH(ExecutionSpace, initialization)            \
+  BENCHMARK_TEMPLATE(benchmarkTriadFirstTouch, ExecutionSpace,                \
+                     initialization)                                          \
+      ->RangeMultiplier(2)                                                     \
+      ->Ranges({{256, 512}, {4, 16}})                                         \
+      ->UseRealTime()
+
+#ifdef KOKKOS_ENABLE_OPENMP
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::OpenMP, Initialization::serial);
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::OpenMP, Initialization::kokkos);
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::OpenMP, Initialization::polk);
+#endif
+
+#ifdef KOKKOS_ENABLE_THREADS
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::Threads, Initialization::serial);
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::Threads, Initialization::kokkos);
+POLK_BENCHMARK_FIRST_TOUCH(Kokkos::Threads, Initialization::polk);
+#endif
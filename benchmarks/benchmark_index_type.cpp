@@ -0,0 +1,50 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "polk/execution_policy_creator.hpp"
+
+template <typename IndexType>
+void benchmarkStencilIndexType(benchmark::State &state) {
+  using Range = polk::Range<3, IndexType>;
+  using Index = typename Range::Index;
+
+  Index const size = state.range(0);
+  Kokkos::View<double ***> in("in", size, size, size);
+  Kokkos::View<double ***> out("out", size, size, size);
+
+  auto policy = polk::ExecutionParameters()
+                    .with(Range({1, 1, 1}, {size - 1, size - 1, size - 1}))
+                    .with(Kokkos::DefaultExecutionSpace{})
+                    .getPolicy();
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "stencil", policy,
+        KOKKOS_LAMBDA(Index const i, Index const j, Index const k) {
+          out(i, j, k) = (in(i - 1, j, k) + in(i + 1, j, k) + in(i, j - 1, k) +
+                          in(i, j + 1, k) + in(i, j, k - 1) + in(i, j, k + 1)) /
+                             6. -
+                         in(i, j, k);
+        });
+    Kokkos::fence();
+  }
+
+  std::int64_t const interior = size - 2;
+  state.SetBytesProcessed(state.iterations() * interior * interior * interior *
+                          2 * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(benchmarkStencilIndexType, polk::UnknownIndexType)
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmarkStencilIndexType, std::int64_t)
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmarkStencilIndexType, std::int32_t)
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256);
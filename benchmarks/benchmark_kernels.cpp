@@ -0,0 +1,208 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "polk/execution_policy_creator.hpp"
+
+template <std::size_t rank> using Point = Kokkos::Array<std::size_t, rank>;
+
+template <typename ExecutionSpace>
+using View1D = Kokkos::View<double *, typename ExecutionSpace::memory_space>;
+
+template <typename ExecutionSpace>
+using View2D = Kokkos::View<double **, typename ExecutionSpace::memory_space>;
+
+template <typename ExecutionSpace>
+using View3D = Kokkos::View<double ***, typename ExecutionSpace::memory_space>;
+
+/**
+ * Run a kernel as long as requested, and report its throughput.
+ */
+template <typename ExecutionSpace, typename Policy, typename Functor>
+void runKernel(benchmark::State &state, ExecutionSpace const &space,
+               Policy const &policy, Functor const &functor,
+               std::int64_t const bytesPerIteration) {
+  Kokkos::parallel_for("warm-up", policy, functor);
+  space.fence();
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for("kernel", policy, functor);
+    space.fence();
+  }
+
+  state.SetBytesProcessed(state.iterations() * bytesPerIteration);
+}
+
+// STREAM triad, arguments are the size and the chunk size
+
+template <typename ExecutionSpace, bool isPolk>
+void benchmarkTriad(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  std::size_t const chunk = state.range(1);
+  ExecutionSpace const space;
+  View1D<ExecutionSpace> a("a", size), b("b", size), c("c", size);
+  double const scalar = 3.;
+
+  auto const kernel = KOKKOS_LAMBDA(std::int64_t const i) {
+    a(i) = b(i) + scalar * c(i);
+  };
+  std::int64_t const bytes = 3 * size * sizeof(double);
+
+  if constexpr (isPolk) {
+    runKernel(state, space,
+              polk::ExecutionParameters()
+                  .with(polk::Range<1>(0, size))
+                  .with(polk::Tiling<1>(chunk))
+                  .with(space)
+                  .getPolicy(),
+              kernel, bytes);
+  } else {
+    runKernel(state, space,
+              Kokkos::RangePolicy<ExecutionSpace>(space, 0, size,
+                                                  Kokkos::ChunkSize(chunk)),
+              kernel, bytes);
+  }
+}
+
+// 2D 5-point stencil, arguments are the size and the tile size
+
+template <typename ExecutionSpace, bool isPolk>
+void benchmarkStencil2D(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  std::size_t const tile = state.range(1);
+  ExecutionSpace const space;
+  View2D<ExecutionSpace> in("in", size, size), out("out", size, size);
+
+  auto const kernel =
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j) {
+    out(i, j) =
+        (in(i - 1, j) + in(i + 1, j) + in(i, j - 1) + in(i, j + 1)) / 4. -
+        in(i, j);
+  };
+  std::int64_t const interior = size - 2;
+  std::int64_t const bytes = 2 * interior * interior * sizeof(double);
+
+  if constexpr (isPolk) {
+    runKernel(state, space,
+              polk::ExecutionParameters()
+                  .with(polk::Range<2>({1, 1}, {size - 1, size - 1}))
+                  .with(polk::Tiling<2>({tile, tile}))
+                  .with(space)
+                  .getPolicy(),
+              kernel, bytes);
+  } else {
+    runKernel(state, space,
+              Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>(
+                  space, Point<2>{1, 1}, Point<2>{size - 1, size - 1},
+                  Point<2>{tile, tile}),
+              kernel, bytes);
+  }
+}
+
+// 3D 7-point stencil, arguments are the size and the tile size of the outer
+// dimensions, the innermost dimension being untiled
+
+template <typename ExecutionSpace, bool isPolk>
+void benchmarkStencil3D(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  std::size_t const tile = state.range(1);
+  ExecutionSpace const space;
+  View3D<ExecutionSpace> in("in", size, size, size);
+  View3D<ExecutionSpace> out("out", size, size, size);
+
+  auto const kernel = KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                                    std::int64_t const k) {
+    out(i, j, k) = (in(i - 1, j, k) + in(i + 1, j, k) + in(i, j - 1, k) +
+                    in(i, j + 1, k) + in(i, j, k - 1) + in(i, j, k + 1)) /
+                       6. -
+                   in(i, j, k);
+  };
+  std::int64_t const interior = size - 2;
+  std::int64_t const bytes =
+      2 * interior * interior * interior * sizeof(double);
+
+  if constexpr (isPolk) {
+    runKernel(state, space,
+              polk::ExecutionParameters()
+                  .with(polk::Range<3>({1, 1, 1},
+                                       {size - 1, size - 1, size - 1}))
+                  .with(polk::Tiling<3>({tile, tile, size}))
+                  .with(space)
+                  .getPolicy(),
+              kernel, bytes);
+  } else {
+    runKernel(state, space,
+              Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<3>>(
+                  space, Point<3>{1, 1, 1},
+                  Point<3>{size - 1, size - 1, size - 1},
+                  Point<3>{tile, tile, size}),
+              kernel, bytes);
+  }
+}
+
+// transpose, arguments are the size and the tile size
+
+template <typename ExecutionSpace, bool isPolk>
+void benchmarkTranspose(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  std::size_t const tile = state.range(1);
+  ExecutionSpace const space;
+  View2D<ExecutionSpace> in("in", size, size), out("out", size, size);
+
+  auto const kernel =
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j) {
+    out(j, i) = in(i, j);
+  };
+  std::int64_t const bytes = 2 * size * size * sizeof(double);
+
+  if constexpr (isPolk) {
+    runKernel(state, space,
+              polk::ExecutionParameters()
+                  .with(polk::Range<2>({0, 0}, {size, size}))
+                  .with(polk::Tiling<2>({tile, tile}))
+                  .with(space)
+                  .getPolicy(),
+              kernel, bytes);
+  } else {
+    runKernel(state, space,
+              Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>(
+                  space, Point<2>{0, 0}, Point<2>{size, size},
+                  Point<2>{tile, tile}),
+              kernel, bytes);
+  }
+}
+
+#define POLK_BENCHMARK_KERNELS(ExecutionSpace, isPolk)                        \
+  BENCHMARK_TEMPLATE(benchmarkTriad, ExecutionSpace, isPolk)                  \
+      ->RangeMultiplier(16)                                                    \
+      ->Ranges({{1 << 16, 1 << 24}, {256, 65536}})                            \
+      ->UseRealTime();                                                        \
+  BENCHMARK_TEMPLATE(benchmarkStencil2D, ExecutionSpace, isPolk)              \
+      ->RangeMultiplier(4)                                                     \
+      ->Ranges({{256, 4096}, {4, 256}})                                       \
+      ->UseRealTime();                                                        \
+  BENCHMARK_TEMPLATE(benchmarkStencil3D, ExecutionSpace, isPolk)              \
+      ->RangeMultiplier(2)                                                     \
+      ->Ranges({{64, 256}, {2, 16}})                                          \
+      ->UseRealTime();                                                        \
+  BENCHMARK_TEMPLATE(benchmarkTranspose, ExecutionSpace, isPolk)              \
+      ->RangeMultiplier(4)                                                     \
+      ->Ranges({{256, 4096}, {4, 256}})                                       \
+      ->UseRealTime()
+
+#ifdef KOKKOS_ENABLE_SERIAL
+POLK_BENCHMARK_KERNELS(Kokkos::Serial, true);
+POLK_BENCHMARK_KERNELS(Kokkos::Serial, false);
+#endif
+
+#ifdef KOKKOS_ENABLE_OPENMP
+POLK_BENCHMARK_KERNELS(Kokkos::OpenMP, true);
+POLK_BENCHMARK_KERNELS(Kokkos::OpenMP, false);
+#endif
+
+#ifdef KOKKOS_ENABLE_THREADS
+POLK_BENCHMARK_KERNELS(Kokkos::Threads, true);
+POLK_BENCHMARK_KERNELS(Kokkos::Threads, false);
+#endif
@@ -2,6 +2,7 @@
 #include <benchmark/benchmark.h>
 
 #include "polk/execution_policy_creator.hpp"
+#include "polk/policy_cache.hpp"
 
 void benchmarkCreatePolkPolicy(benchmark::State &state) {
   while (state.KeepRunning()) {
@@ -25,3 +26,21 @@ void benchmarkCreateKokkosPolicy(benchmark::State &state) {
 }
 
 BENCHMARK(benchmarkCreateKokkosPolicy);
+
+auto getCachedParameters() {
+  return polk::ExecutionParameters()
+      .with(Kokkos::DefaultExecutionSpace{})
+      .with(polk::Range<3>({0, 0, 0}, {100, 100, 100}))
+      .with(polk::Tiling<3>({10, 10, 10}));
+}
+
+void benchmarkCreateCachedPolkPolicy(benchmark::State &state) {
+  polk::CachedPolicy<decltype(getCachedParameters())> cache;
+
+  while (state.KeepRunning()) {
+    [[maybe_unused]] auto const &policy =
+        cache.getPolicy("benchmark", getCachedParameters());
+  }
+}
+
+BENCHMARK(benchmarkCreateCachedPolkPolicy);
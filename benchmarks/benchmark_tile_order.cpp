@@ -0,0 +1,64 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+
+using HostView2D =
+    Kokkos::View<double **, Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+template <typename ExecutionParameters>
+void runStencil(benchmark::State &state,
+                ExecutionParameters const &parameters, HostView2D const &in,
+                HostView2D const &out) {
+  while (state.KeepRunning()) {
+    polk::parallel_for(
+        "stencil", parameters,
+        KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+          out(i, j) = (in(i - 1, j) + in(i + 1, j) + in(i, j - 1) +
+                       in(i, j + 1)) /
+                          4. -
+                      in(i, j);
+        });
+    Kokkos::fence();
+  }
+
+  std::int64_t const interior = state.range(0) - 2;
+  state.SetBytesProcessed(state.iterations() * interior * interior * 2 *
+                          sizeof(double));
+}
+
+template <typename TileOrder>
+void benchmarkStencilTileOrder(benchmark::State &state) {
+  std::size_t const size = state.range(0);
+  HostView2D in("in", size, size);
+  HostView2D out("out", size, size);
+
+  auto const parameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({1, 1}, {size - 1, size - 1}))
+          .with(polk::Tiling<2>({64, 64}))
+          .with(Kokkos::DefaultHostExecutionSpace{});
+
+  if constexpr (std::is_same_v<TileOrder, polk::UnknownTileOrder>) {
+    runStencil(state, parameters, in, out);
+  } else {
+    runStencil(state, parameters.with(TileOrder()), in, out);
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmarkStencilTileOrder, polk::UnknownTileOrder)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Arg(8192);
+BENCHMARK_TEMPLATE(benchmarkStencilTileOrder, polk::TileOrder<polk::Morton>)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Arg(8192);
+BENCHMARK_TEMPLATE(benchmarkStencilTileOrder, polk::TileOrder<polk::Hilbert>)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Arg(8192);
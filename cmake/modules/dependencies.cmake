@@ -39,3 +39,7 @@ if(POLK_ENABLE_BENCHMARKS)
         set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
     endif()
 endif()
+
+if(POLK_ENABLE_COMPILE_BENCHMARKS)
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+endif()
@@ -12,3 +12,8 @@ option(POLK_ENABLE_BENCHMARKS "Build benchmarks for the library")
 
 # compile benchmarks
 option(POLK_ENABLE_COMPILE_BENCHMARKS "Build compile benchmarks of the library")
+set(POLK_COMPILE_BENCHMARK_REPETITIONS 5 CACHE STRING "Number of compilations of each compile benchmark in the report")
+set(POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK 50 CACHE STRING "Number of kernels per rank of the compile stress benchmarks")
+
+# profiling
+option(POLK_ENABLE_PROFILING "Enable kernel profiling hooks of the library" ON)
@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "polk/execution_policy_creator.hpp"
+
+#ifndef POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK
+#define POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK 50
+#endif
+
+template <int id, int rank> struct Kernel {
+  template <typename... Indices>
+  KOKKOS_FUNCTION void operator()(Indices const...) const {}
+};
+
+template <int id, int rank> void launch() {
+  if constexpr (rank == 1) {
+    Kokkos::parallel_for("kernel",
+                         Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
+                             Kokkos::DefaultExecutionSpace{}, 0, 10,
+                             Kokkos::ChunkSize(2)),
+                         Kernel<id, rank>());
+  } else {
+    Kokkos::Array<std::size_t, rank> begin{}, end{}, tile{};
+    for (int d = 0; d < rank; d++) {
+      end[d] = 10;
+      tile[d] = 2;
+    }
+
+    using Policy = Kokkos::MDRangePolicy<Kokkos::DefaultExecutionSpace,
+                                         Kokkos::Rank<rank>>;
+
+    Kokkos::parallel_for(
+        "kernel", Policy(Kokkos::DefaultExecutionSpace{}, begin, end, tile),
+        Kernel<id, rank>());
+  }
+}
+
+template <int rank, int... ids>
+void launchKernels(std::integer_sequence<int, ids...>) {
+  (launch<ids, rank>(), ...);
+}
+
+template <int... ranks> void launchRanks(std::integer_sequence<int, ranks...>) {
+  (launchKernels<ranks + 1>(
+       std::make_integer_sequence<int,
+                                  POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK>()),
+   ...);
+}
+
+int main() { launchRanks(std::make_integer_sequence<int, 6>()); }
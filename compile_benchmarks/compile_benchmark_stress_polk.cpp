@@ -0,0 +1,45 @@
+#include <cstddef>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "polk/execution_policy_creator.hpp"
+
+#ifndef POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK
+#define POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK 50
+#endif
+
+template <int id, int rank> struct Kernel {
+  template <typename... Indices>
+  KOKKOS_FUNCTION void operator()(Indices const...) const {}
+};
+
+template <int id, int rank> void launch() {
+  Kokkos::Array<std::size_t, rank> begin{}, end{}, tile{};
+  for (int d = 0; d < rank; d++) {
+    end[d] = 10;
+    tile[d] = 2;
+  }
+
+  Kokkos::parallel_for("kernel",
+                       polk::ExecutionParameters()
+                           .with(Kokkos::DefaultExecutionSpace{})
+                           .with(polk::Range<rank>(begin, end))
+                           .with(polk::Tiling<rank>(tile))
+                           .getPolicy(),
+                       Kernel<id, rank>());
+}
+
+template <int rank, int... ids>
+void launchKernels(std::integer_sequence<int, ids...>) {
+  (launch<ids, rank>(), ...);
+}
+
+template <int... ranks> void launchRanks(std::integer_sequence<int, ranks...>) {
+  (launchKernels<ranks + 1>(
+       std::make_integer_sequence<int,
+                                  POLK_COMPILE_BENCHMARK_KERNELS_PER_RANK>()),
+   ...);
+}
+
+int main() { launchRanks(std::make_integer_sequence<int, 6>()); }
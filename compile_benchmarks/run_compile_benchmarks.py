@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""Run the compile benchmarks and report their compilation time.
+
+Each compile benchmark found in the compilation database is compiled several
+times with the command of the build system, with the addition of
+`-ftime-trace` for Clang or `-ftime-report` for GCC. The wall time, the
+frontend and backend times, and the number of template instantiations (Clang
+only) are averaged, and benchmarks using polk are compared to their Kokkos
+counterparts.
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+BENCHMARK_PATTERN = re.compile(r"compile_benchmark_(.+)_(polk|kokkos)\.cpp$")
+GCC_PHASE_PATTERN = re.compile(
+    r"^\s*phase (.+?)\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)"
+    r"\s*([\d.]+)"
+)
+GCC_FRONTEND_PHASES = ("parsing", "lang. deferred")
+GCC_BACKEND_PHASES = ("opt and generate",)
+
+
+def get_arguments(entry):
+    """Get the arguments of a compilation database entry."""
+    if "arguments" in entry:
+        return list(entry["arguments"])
+
+    return shlex.split(entry["command"])
+
+
+def get_output(arguments):
+    """Get the object file of a compile command."""
+    for index, argument in enumerate(arguments):
+        if argument == "-o":
+            return arguments[index + 1]
+        if argument.startswith("-o"):
+            return argument[2:]
+
+    raise ValueError("No output in compile command")
+
+
+def is_clang(compiler, directory):
+    """Check if a compiler is Clang."""
+    version = subprocess.run(
+        [compiler, "--version"],
+        cwd=directory,
+        capture_output=True,
+        text=True,
+        check=True,
+    )
+
+    return "clang" in version.stdout.lower()
+
+
+def parse_time_trace(path):
+    """Parse a Clang time trace.
+
+    Returns the frontend and backend times in seconds, and the number of
+    template instantiations.
+    """
+    with open(path, encoding="utf-8") as file:
+        events = json.load(file)["traceEvents"]
+
+    totals = {
+        event["name"]: event
+        for event in events
+        if event.get("name", "").startswith("Total ")
+    }
+
+    def get_seconds(name):
+        return totals[name]["dur"] / 1e6 if name in totals else 0.0
+
+    def get_count(name):
+        return totals[name]["args"]["count"] if name in totals else 0
+
+    instantiations = get_count("Total InstantiateFunction") + get_count(
+        "Total InstantiateClass"
+    )
+
+    return (
+        get_seconds("Total Frontend"),
+        get_seconds("Total Backend"),
+        instantiations,
+    )
+
+
+def parse_time_report(report):
+    """Parse a GCC time report.
+
+    Returns the frontend and backend wall times in seconds, the number of
+    template instantiations being unavailable.
+    """
+    frontend = 0.0
+    backend = 0.0
+    for line in report.splitlines():
+        match = GCC_PHASE_PATTERN.match(line)
+        if match is None:
+            continue
+
+        phase, seconds = match.group(1), float(match.group(2))
+        if phase in GCC_FRONTEND_PHASES:
+            frontend += seconds
+        elif phase in GCC_BACKEND_PHASES:
+            backend += seconds
+
+    return frontend, backend, None
+
+
+def run_benchmark(entry, repetitions):
+    """Compile a benchmark several times and collect its measures."""
+    arguments = get_arguments(entry)
+    directory = entry["directory"]
+    output = get_output(arguments)
+    clang = is_clang(arguments[0], directory)
+    arguments += ["-ftime-trace"] if clang else ["-ftime-report"]
+
+    measures = []
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        process = subprocess.run(
+            arguments, cwd=directory, capture_output=True, text=True
+        )
+        wall = time.perf_counter() - start
+        if process.returncode != 0:
+            sys.exit(f"Compilation of {entry['file']} failed:\n{process.stderr}")
+
+        if clang:
+            trace = os.path.join(directory, str(Path(output).with_suffix(".json")))
+            frontend, backend, instantiations = parse_time_trace(trace)
+        else:
+            frontend, backend, instantiations = parse_time_report(process.stderr)
+
+        measures.append((wall, frontend, backend, instantiations))
+
+    def mean(index):
+        values = [measure[index] for measure in measures]
+        if None in values:
+            return None
+        return statistics.mean(values)
+
+    return {
+        "wall": mean(0),
+        "wall_min": min(measure[0] for measure in measures),
+        "frontend": mean(1),
+        "backend": mean(2),
+        "instantiations": mean(3),
+    }
+
+
+def format_value(value, digits=3):
+    """Format a measure, which may be unavailable."""
+    if value is None:
+        return "n/a"
+
+    return f"{value:.{digits}f}"
+
+
+def create_report(results, repetitions):
+    """Create the Markdown report."""
+    lines = [
+        "# Compile benchmark report",
+        "",
+        f"Averages over {repetitions} compilations, times in seconds.",
+        "",
+        "| Benchmark | Library | Wall | Wall (min) | Frontend | Backend "
+        "| Instantiations |",
+        "|---|---|---|---|---|---|---|",
+    ]
+    for (name, library), result in sorted(results.items()):
+        lines.append(
+            f"| {name} | {library} | {format_value(result['wall'])} "
+            f"| {format_value(result['wall_min'])} "
+            f"| {format_value(result['frontend'])} "
+            f"| {format_value(result['backend'])} "
+            f"| {format_value(result['instantiations'], 0)} |"
+        )
+
+    lines += [
+        "",
+        "## Polk over Kokkos",
+        "",
+        "| Benchmark | Wall | Frontend | Backend | Instantiations |",
+        "|---|---|---|---|---|",
+    ]
+    for name in sorted({name for name, _ in results}):
+        if (name, "polk") not in results or (name, "kokkos") not in results:
+            continue
+
+        polk = results[(name, "polk")]
+        kokkos = results[(name, "kokkos")]
+
+        def ratio(key):
+            if polk[key] is None or kokkos[key] is None or kokkos[key] == 0:
+                return "n/a"
+            return f"{polk[key] / kokkos[key]:.2f}"
+
+        lines.append(
+            f"| {name} | {ratio('wall')} | {ratio('frontend')} "
+            f"| {ratio('backend')} | {ratio('instantiations')} |"
+        )
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--compile-commands",
+        required=True,
+        type=Path,
+        help="compilation database of the build",
+    )
+    parser.add_argument(
+        "--repetitions",
+        type=int,
+        default=5,
+        help="number of compilations of each benchmark",
+    )
+    parser.add_argument(
+        "--filter",
+        default="",
+        help="regular expression selecting the benchmarks to run",
+    )
+    parser.add_argument(
+        "--output", type=Path, help="file where the report is written"
+    )
+    arguments = parser.parse_args()
+
+    with open(arguments.compile_commands, encoding="utf-8") as file:
+        entries = json.load(file)
+
+    results = {}
+    for entry in entries:
+        match = BENCHMARK_PATTERN.search(entry["file"])
+        if match is None or not re.search(arguments.filter, entry["file"]):
+            continue
+
+        name, library = match.group(1), match.group(2)
+        print(f"Compiling {name} ({library})", flush=True)
+        results[(name, library)] = run_benchmark(entry, arguments.repetitions)
+
+    if not results:
+        sys.exit("No compile benchmark found in the compilation database")
+
+    report = create_report(results, arguments.repetitions)
+    print(report)
+    if arguments.output is not None:
+        arguments.output.write_text(report, encoding="utf-8")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,29 +1,11 @@
-#include <string>
-
 #include <Kokkos_Core.hpp>
 #include <Kokkos_DualView.hpp>
 
+#include "polk/dispatch.hpp"
 #include "polk/execution_policy_creator.hpp"
 
 namespace dynk {
 
-template <typename ExecutionParameters, typename Kernel,
-          typename DeviceExecutionSpace = Kokkos::DefaultExecutionSpace,
-          typename HostExecutionSpace = Kokkos::DefaultHostExecutionSpace>
-void parallel_for(bool const isExecutedOnDevice, std::string const &label,
-                  ExecutionParameters const &policyCreator,
-                  Kernel const &kernel) {
-  Kokkos::fence("begin dynamic parallel for");
-  if (isExecutedOnDevice) {
-    Kokkos::parallel_for(
-        label, policyCreator.with(DeviceExecutionSpace()).getPolicy(), kernel);
-  } else {
-    Kokkos::parallel_for(
-        label, policyCreator.with(HostExecutionSpace()).getPolicy(), kernel);
-  }
-  Kokkos::fence("end dynamic parallel for");
-}
-
 template <
     typename T, typename... P,
     typename DeviceMemorySpace = Kokkos::DefaultExecutionSpace::memory_space,
@@ -59,12 +41,13 @@ int main() {
   Kokkos::DualView<int **> data("data", 100, 100);
 
   auto dataV = dynk::getViewAnonymous(data, isExecutedOnDevice);
-  dynk::parallel_for(
-      isExecutedOnDevice, "perform computation",
+  polk::dispatch(
+      "perform computation", polk::hostOrDevice(isExecutedOnDevice),
       polk::ExecutionParameters().with(polk::Range<2>({0, 0}, {100, 100})),
       KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
         dataV(i, j) = i + j;
-      });
+      },
+      polk::Fence::after);
   dynk::setModified(data, isExecutedOnDevice);
 
   data.template sync<Kokkos::DefaultHostExecutionSpace>();
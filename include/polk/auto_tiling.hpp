@@ -0,0 +1,240 @@
+#ifndef __POLK_AUTO_TILING_HPP__
+#define __POLK_AUTO_TILING_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Sizes of the host data caches, in bytes.
+ */
+struct CacheSizes {
+  std::size_t mL1;
+  std::size_t mL2;
+};
+
+/**
+ * Cache sizes used when they cannot be detected.
+ */
+CacheSizes constexpr defaultCacheSizes = {32 * 1024, 1024 * 1024};
+
+namespace impl {
+
+/**
+ * Parse a cache size as written by sysfs (e.g. "48K" or "2M").
+ * @param text Cache size.
+ * @return Cache size in bytes, 0 if it cannot be parsed.
+ */
+inline std::size_t parseCacheSize(std::string const &text) {
+  std::size_t position = 0;
+  std::size_t size = 0;
+  try {
+    size = std::stoul(text, &position);
+  } catch (...) {
+    return 0;
+  }
+
+  if (position < text.size()) {
+    switch (text[position]) {
+    case 'K':
+      return size * 1024;
+    case 'M':
+      return size * 1024 * 1024;
+    case 'G':
+      return size * 1024 * 1024 * 1024;
+    }
+  }
+
+  return size;
+}
+
+/**
+ * Read the host cache sizes.
+ * On Linux, the sizes are read from the sysfs entries of the first CPU.
+ * Missing sizes are taken from `defaultCacheSizes`.
+ * @return Cache sizes.
+ */
+inline CacheSizes readHostCacheSizes() {
+  CacheSizes cacheSizes = {0, 0};
+
+#ifdef __linux__
+  for (int index = 0;; index++) {
+    std::string const path =
+        "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index);
+    std::ifstream levelFile(path + "/level");
+    if (!levelFile) {
+      break;
+    }
+
+    int level = 0;
+    std::string type, size;
+    levelFile >> level;
+    std::ifstream(path + "/type") >> type;
+    std::ifstream(path + "/size") >> size;
+
+    if (type == "Instruction") {
+      continue;
+    }
+
+    if (level == 1) {
+      cacheSizes.mL1 = parseCacheSize(size);
+    } else if (level == 2) {
+      cacheSizes.mL2 = parseCacheSize(size);
+    }
+  }
+#endif
+
+  if (cacheSizes.mL1 == 0) {
+    cacheSizes.mL1 = defaultCacheSizes.mL1;
+  }
+  if (cacheSizes.mL2 == 0) {
+    cacheSizes.mL2 = defaultCacheSizes.mL2;
+  }
+
+  return cacheSizes;
+}
+
+/**
+ * Largest integer whose power does not exceed a value.
+ * @param value Value.
+ * @param power Power.
+ * @return Integer root of the value, at least 1.
+ */
+inline std::size_t getIntegerRoot(std::size_t const value,
+                                  std::size_t const power) {
+  auto const raise = [power](std::size_t const base) {
+    double result = 1;
+    for (std::size_t i = 0; i < power; i++) {
+      result *= static_cast<double>(base);
+    }
+    return result;
+  };
+
+  auto root = static_cast<std::size_t>(
+      std::llround(std::pow(static_cast<double>(value), 1. / power)));
+  while (root > 1 && raise(root) > static_cast<double>(value)) {
+    root--;
+  }
+  while (raise(root + 1) <= static_cast<double>(value)) {
+    root++;
+  }
+
+  return std::max<std::size_t>(root, 1);
+}
+
+/**
+ * Compute a cache-aware tile.
+ * The innermost dimension of the tile is sized to stream through the L1
+ * cache, then the tile is extended evenly in the other dimensions until it
+ * fills half of the L2 cache. Outer dimensions are finally shrunk until there
+ * are at least two tiles per thread.
+ * @tparam rank Rank of the tile.
+ * @param extents Extents of the range.
+ * @param bytesPerIteration Memory footprint of one iteration, in bytes.
+ * @param isInnerLeft If the first dimension is the innermost one, otherwise
+ * the last dimension is.
+ * @param concurrency Number of threads of the execution space.
+ * @param cacheSizes Cache sizes.
+ * @return Tile, each extent being between 1 and the extent of the range.
+ */
+template <std::size_t rank>
+Kokkos::Array<std::size_t, rank>
+computeAutoTile(Kokkos::Array<std::size_t, rank> const &extents,
+                std::size_t const bytesPerIteration, bool const isInnerLeft,
+                std::size_t const concurrency, CacheSizes const &cacheSizes) {
+  Kokkos::Array<std::size_t, rank> tile;
+  auto const clampTile = [](std::size_t const value,
+                            std::size_t const extent) {
+    return std::max<std::size_t>(std::min(value, extent), 1);
+  };
+  auto const getDimension = [isInnerLeft](std::size_t const i) {
+    return isInnerLeft ? i : rank - 1 - i;
+  };
+  auto const countTiles = [&extents, &tile]() {
+    std::size_t count = 1;
+    for (std::size_t d = 0; d < rank; d++) {
+      count *= (extents[d] + tile[d] - 1) / tile[d];
+    }
+    return count;
+  };
+  std::size_t const bytes = std::max<std::size_t>(bytesPerIteration, 1);
+
+  // innermost dimension
+  std::size_t const inner = getDimension(0);
+  tile[inner] = clampTile(cacheSizes.mL1 / bytes, extents[inner]);
+
+  // outer dimensions
+  std::size_t remaining =
+      std::max<std::size_t>(cacheSizes.mL2 / 2 / bytes / tile[inner], 1);
+  for (std::size_t i = 1; i < rank; i++) {
+    std::size_t const d = getDimension(i);
+    tile[d] = clampTile(getIntegerRoot(remaining, rank - i), extents[d]);
+    remaining = std::max<std::size_t>(remaining / tile[d], 1);
+  }
+
+  // parallelism, starting from the outermost dimension
+  std::size_t const minTiles = 2 * std::max<std::size_t>(concurrency, 1);
+  for (std::size_t i = rank; i-- > 0 && countTiles() < minTiles;) {
+    std::size_t const d = getDimension(i);
+    while (tile[d] > 1 && countTiles() < minTiles) {
+      tile[d] = (tile[d] + 1) / 2;
+    }
+  }
+
+  return tile;
+}
+
+} // namespace impl
+
+/**
+ * Get the host cache sizes.
+ * The sizes are detected once and reused afterwards.
+ * @return Cache sizes.
+ */
+inline CacheSizes const &getHostCacheSizes() {
+  static CacheSizes const cacheSizes = impl::readHostCacheSizes();
+  return cacheSizes;
+}
+
+namespace impl {
+
+/**
+ * Computation of automatic tiles.
+ * @tparam Tiling Automatic tile class.
+ */
+template <typename Tiling> struct AutoTiler {
+  /**
+   * Compute the tile of a range for the host caches.
+   * @tparam rank Rank of the range.
+   * @param tiling Automatic tile parameter.
+   * @param extents Extents of the range.
+   * @param isInnerLeft If the first dimension is the innermost one, otherwise
+   * the last dimension is.
+   * @param concurrency Number of threads of the execution space.
+   * @return Tile, each extent being between 1 and the extent of the range.
+   */
+  template <std::size_t rank>
+  static Kokkos::Array<std::size_t, rank>
+  getTile(Tiling const &tiling, Kokkos::Array<std::size_t, rank> const &extents,
+          bool const isInnerLeft, std::size_t const concurrency) {
+    return computeAutoTile(extents, tiling.getBytesPerIteration(),
+                           isInnerLeft, concurrency, getHostCacheSizes());
+  }
+};
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_AUTO_TILING_HPP__
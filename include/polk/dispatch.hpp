@@ -0,0 +1,156 @@
+#ifndef __POLK_DISPATCH_HPP__
+#define __POLK_DISPATCH_HPP__
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "kokkos_concepts.hpp"
+#include "parallel.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Fencing of a dispatched kernel.
+ * Only the selected execution space instance is fenced.
+ */
+enum class Fence {
+  none,
+  before,
+  after,
+  beforeAndAfter,
+};
+
+/**
+ * Space selector class.
+ * Candidate execution space instances, one of which is selected at runtime.
+ * A kernel dispatched with a selector is instantiated once per candidate.
+ * @tparam ExecutionSpaces Candidate execution space classes.
+ */
+template <kokkos_addendum::SpaceType... ExecutionSpaces> class SpaceSelector {
+  static_assert(sizeof...(ExecutionSpaces) > 0,
+                "At least one execution space must be given");
+
+  std::size_t mIndex;
+  std::tuple<ExecutionSpaces...> mSpaces;
+
+public:
+  /**
+   * Marker to identify the class as a space selector.
+   */
+  using SpaceSelectorType = SpaceSelector<ExecutionSpaces...>;
+
+  SpaceSelector() = delete;
+
+  /**
+   * Constructor.
+   * @param index Index of the selected execution space.
+   * @param spaces Candidate execution space instances.
+   * @throw std::out_of_range If the index does not match a candidate.
+   */
+  constexpr SpaceSelector(std::size_t index, ExecutionSpaces const &...spaces)
+      : mIndex(index), mSpaces(spaces...) {
+    if (index >= getSize()) {
+      throw std::out_of_range("Selected execution space index out of range");
+    }
+  }
+
+  /**
+   * Getter for the index of the selected execution space.
+   * @return Index.
+   */
+  std::size_t constexpr getIndex() const { return mIndex; }
+
+  /**
+   * Getter for a candidate execution space.
+   * @tparam index Index of the candidate.
+   * @return Execution space instance.
+   */
+  template <std::size_t index> auto constexpr getSpace() const {
+    return std::get<index>(mSpaces);
+  }
+
+  /**
+   * Getter for the number of candidates.
+   * @return Number of candidates.
+   */
+  static std::size_t constexpr getSize() { return sizeof...(ExecutionSpaces); }
+};
+
+/**
+ * Concept for the space selector.
+ */
+template <typename T>
+concept SpaceSelectorType = std::same_as<T, typename T::SpaceSelectorType>;
+
+/**
+ * Create a selector between a host and a device execution space.
+ * @tparam DeviceExecutionSpace Device execution space class.
+ * @tparam HostExecutionSpace Host execution space class.
+ * @param isExecutedOnDevice If the device execution space is selected.
+ * @param deviceSpace Device execution space instance.
+ * @param hostSpace Host execution space instance.
+ * @return Space selector, the host being the first candidate.
+ */
+template <
+    kokkos_addendum::SpaceType DeviceExecutionSpace =
+        Kokkos::DefaultExecutionSpace,
+    kokkos_addendum::SpaceType HostExecutionSpace =
+        Kokkos::DefaultHostExecutionSpace>
+SpaceSelector<HostExecutionSpace, DeviceExecutionSpace>
+hostOrDevice(bool const isExecutedOnDevice,
+             DeviceExecutionSpace const &deviceSpace = DeviceExecutionSpace(),
+             HostExecutionSpace const &hostSpace = HostExecutionSpace()) {
+  return {isExecutedOnDevice ? 1u : 0u, hostSpace, deviceSpace};
+}
+
+/**
+ * Launch a parallel for on an execution space selected at runtime.
+ * The kernel is instantiated for each candidate, and launched with
+ * `polk::parallel_for` on the selected one. No global fence is performed.
+ * @tparam Selector Space selector class.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param selector Space selector.
+ * @param parameters Execution parameters, without execution space.
+ * @param functor Kernel.
+ * @param fence Fencing of the selected execution space instance.
+ */
+template <SpaceSelectorType Selector,
+          ExecutionParametersType ExecutionParameters, typename Functor>
+void dispatch(std::string const &label, Selector const &selector,
+              ExecutionParameters const &parameters, Functor const &functor,
+              Fence const fence = Fence::none) {
+  static_assert(!ExecutionParameters::hasExecutionSpace(),
+                "Execution space already set");
+
+  auto const launch = [&](auto const &space) {
+    if (fence == Fence::before || fence == Fence::beforeAndAfter) {
+      space.fence("polk: before " + label);
+    }
+    parallel_for(label, parameters.with(space), functor);
+    if (fence == Fence::after || fence == Fence::beforeAndAfter) {
+      space.fence("polk: after " + label);
+    }
+  };
+
+  [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+    ((selector.getIndex() == indices
+          ? launch(selector.template getSpace<indices>())
+          : void()),
+     ...);
+  }(std::make_index_sequence<Selector::getSize()>());
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_DISPATCH_HPP__
@@ -0,0 +1,240 @@
+#ifndef __POLK_DYNAMIC_RANGE_HPP__
+#define __POLK_DYNAMIC_RANGE_HPP__
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Dynamic range class.
+ * Range whose rank is only known at runtime, up to a maximum rank. It is
+ * turned into a `polk::Range` of the right rank by `polk::dispatch_rank`.
+ * @tparam maxRank Maximum rank of the range.
+ * @tparam IndexType Integral type used by Kokkos to iterate over the range.
+ * If not specified, the Kokkos default index type is used.
+ */
+template <int maxRank = 3, typename IndexType = UnknownIndexType>
+class DynamicRange {
+  static_assert(maxRank >= 1, "Maximum rank must be at least 1");
+
+public:
+  /**
+   * Type of the coordinates.
+   */
+  using Index = typename Range<1, IndexType>::Index;
+
+private:
+  int mRank;
+  Kokkos::Array<Index, maxRank> mBegin;
+  Kokkos::Array<Index, maxRank> mEnd;
+
+public:
+  /**
+   * Marker to identify the class as a dynamic range.
+   */
+  using DynamicRangeType = DynamicRange<maxRank, IndexType>;
+
+  DynamicRange() = delete;
+
+  /**
+   * Constructor.
+   * The rank is the number of begin coordinates.
+   * @param begin Begin coordinates.
+   * @param end End coordinates, as many as begin coordinates.
+   */
+  DynamicRange(std::vector<Index> const &begin, std::vector<Index> const &end)
+      : mRank(static_cast<int>(begin.size())) {
+    if (begin.size() != end.size()) {
+      throw std::invalid_argument("Range begin rank and end rank missmatch");
+    }
+    if (mRank < 1 || mRank > maxRank) {
+      throw std::invalid_argument("Range rank out of bounds");
+    }
+
+    for (int d = 0; d < mRank; d++) {
+      mBegin[d] = begin[d];
+      mEnd[d] = end[d];
+    }
+  }
+
+  /**
+   * Getter for the rank.
+   * @return Rank of the range.
+   */
+  int getRank() const { return mRank; }
+
+  /**
+   * Getter for the maximum rank.
+   * @return Maximum rank of the range.
+   */
+  static int constexpr getMaxRank() { return maxRank; }
+
+  /**
+   * Convert to a range of static rank.
+   * @tparam rank Rank of the range, which must be the runtime rank.
+   * @return Range.
+   */
+  template <int rank> Range<rank, IndexType> getRange() const {
+    static_assert(rank >= 1 && rank <= maxRank, "Range rank out of bounds");
+    if (rank != mRank) {
+      throw std::invalid_argument("Range rank missmatch");
+    }
+
+    Kokkos::Array<Index, rank> begin;
+    Kokkos::Array<Index, rank> end;
+    for (int d = 0; d < rank; d++) {
+      begin[d] = mBegin[d];
+      end[d] = mEnd[d];
+    }
+
+    return Range<rank, IndexType>(begin, end);
+  }
+};
+
+/**
+ * Concept for the dynamic range.
+ */
+template <typename T>
+concept DynamicRangeType = std::same_as<T, typename T::DynamicRangeType>;
+
+/**
+ * Dynamic tile class.
+ * Tile whose rank is only known at runtime, up to a maximum rank.
+ * @tparam maxRank Maximum rank of the tile.
+ */
+template <int maxRank = 3> class DynamicTiling {
+  static_assert(maxRank >= 1, "Maximum rank must be at least 1");
+
+  int mRank;
+  Kokkos::Array<std::size_t, maxRank> mTile;
+
+public:
+  /**
+   * Marker to identify the class as a dynamic tile.
+   */
+  using DynamicTilingType = DynamicTiling<maxRank>;
+
+  DynamicTiling() = delete;
+
+  /**
+   * Constructor.
+   * The rank is the number of tile sizes.
+   * @param tile Tile sizes.
+   */
+  DynamicTiling(std::vector<std::size_t> const &tile)
+      : mRank(static_cast<int>(tile.size())) {
+    if (mRank < 1 || mRank > maxRank) {
+      throw std::invalid_argument("Tiling rank out of bounds");
+    }
+
+    for (int d = 0; d < mRank; d++) {
+      mTile[d] = tile[d];
+    }
+  }
+
+  /**
+   * Getter for the rank.
+   * @return Rank of the tile.
+   */
+  int getRank() const { return mRank; }
+
+  /**
+   * Getter for the maximum rank.
+   * @return Maximum rank of the tile.
+   */
+  static int constexpr getMaxRank() { return maxRank; }
+
+  /**
+   * Convert to a tile of static rank.
+   * @tparam rank Rank of the tile, which must be the runtime rank.
+   * @return Tile.
+   */
+  template <int rank> Tiling<rank> getTiling() const {
+    static_assert(rank >= 1 && rank <= maxRank, "Tiling rank out of bounds");
+    if (rank != mRank) {
+      throw std::invalid_argument("Tiling rank missmatch");
+    }
+
+    Kokkos::Array<std::size_t, rank> tile;
+    for (int d = 0; d < rank; d++) {
+      tile[d] = mTile[d];
+    }
+
+    return Tiling<rank>(tile);
+  }
+};
+
+/**
+ * Concept for the dynamic tile.
+ */
+template <typename T>
+concept DynamicTilingType = std::same_as<T, typename T::DynamicTilingType>;
+
+/**
+ * Call a function with execution parameters of the rank of a dynamic range.
+ * The function is instantiated for each rank up to the maximum rank, and
+ * only the one of the runtime rank is called, so that kernels are still
+ * compiled for a static rank.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam DynamicRange Dynamic range class.
+ * @tparam Function Function class, called with execution parameters.
+ * @param parameters Execution parameters, without range nor tile.
+ * @param range Dynamic range.
+ * @param function Function, usually a generic lambda.
+ */
+template <ExecutionParametersType ExecutionParameters,
+          DynamicRangeType DynamicRange, typename Function>
+void dispatch_rank(ExecutionParameters const &parameters,
+                   DynamicRange const &range, Function const &function) {
+  [&]<int... ranks>(std::integer_sequence<int, ranks...>) {
+    ((range.getRank() == ranks + 1 &&
+      (function(parameters.with(range.template getRange<ranks + 1>())), true)),
+     ...);
+  }(std::make_integer_sequence<int, DynamicRange::getMaxRank()>());
+}
+
+/**
+ * Call a function with execution parameters of the rank of a dynamic range
+ * and of a dynamic tile.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam DynamicRange Dynamic range class.
+ * @tparam DynamicTiling Dynamic tile class.
+ * @tparam Function Function class, called with execution parameters.
+ * @param parameters Execution parameters, without range nor tile.
+ * @param range Dynamic range.
+ * @param tiling Dynamic tile, with the same rank as the range.
+ * @param function Function, usually a generic lambda.
+ * @throw std::invalid_argument If the ranks of the range and of the tile
+ * differ.
+ */
+template <ExecutionParametersType ExecutionParameters,
+          DynamicRangeType DynamicRange, DynamicTilingType DynamicTiling,
+          typename Function>
+void dispatch_rank(ExecutionParameters const &parameters,
+                   DynamicRange const &range, DynamicTiling const &tiling,
+                   Function const &function) {
+  dispatch_rank(parameters, range, [&](auto const &rangeParameters) {
+    int constexpr rank =
+        std::remove_cvref_t<decltype(rangeParameters)>::getRank();
+    if constexpr (rank <= DynamicTiling::getMaxRank()) {
+      function(rangeParameters.with(tiling.template getTiling<rank>()));
+    } else {
+      throw std::invalid_argument("Range rank and tiling rank missmatch");
+    }
+  });
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_DYNAMIC_RANGE_HPP__
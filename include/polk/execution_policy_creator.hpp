@@ -1,31 +1,72 @@
 #ifndef __CREATION_POLICY_CREATOR_HPP__
 #define __CREATION_POLICY_CREATOR_HPP__
 
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
 #include <Kokkos_Core.hpp>
 
+#include "hints.hpp"
 #include "kokkos_concepts.hpp"
+#include "reducer.hpp"
+#include "team.hpp"
+#include "work_tag.hpp"
 
 /**
  * Polk objects.
  */
 namespace polk {
 
+/**
+ * Default rank.
+ */
+int constexpr unknownRank = 0;
+
+/**
+ * Default index type.
+ */
+struct UnknownIndexType {};
+
 /**
  * Range class.
  * Can be single-dimensional or multidimensional, but everything is treated as
  * multidimensional.
+ * @tparam rank Rank of the range.
+ * @tparam IndexType Integral type used by Kokkos to iterate over the range.
+ * If not specified, the Kokkos default index type is used.
  */
-template <int rank = 1> struct Range {
-  static int constexpr mRank = rank;
+template <int rank = 1, typename IndexType = UnknownIndexType> struct Range {
+  static_assert(std::is_same_v<IndexType, UnknownIndexType> ||
+                    std::is_integral_v<IndexType>,
+                "Index type must be an integral type");
 
-  Kokkos::Array<std::size_t, rank> mBegin;
-  Kokkos::Array<std::size_t, rank> mEnd;
+  static int constexpr mRank = rank;
 
 public:
+  /**
+   * Type of the coordinates.
+   * Defaults to `std::size_t` if no index type is specified.
+   */
+  using Index = std::conditional_t<std::is_same_v<IndexType, UnknownIndexType>,
+                                   std::size_t, IndexType>;
+
+  /**
+   * Corresponding Kokkos index type property, `void` if no index type is
+   * specified.
+   */
+  using KokkosIndexType =
+      std::conditional_t<std::is_same_v<IndexType, UnknownIndexType>, void,
+                         Kokkos::IndexType<IndexType>>;
+
+  Kokkos::Array<Index, rank> mBegin;
+  Kokkos::Array<Index, rank> mEnd;
+
   /**
    * Marker to identify the class as a range.
    */
-  using RangeType = Range<rank>;
+  using RangeType = Range<rank, IndexType>;
 
   Range() = delete;
 
@@ -36,8 +77,8 @@ public:
    * `rank`.
    * @param end Array of end coordinates. Must have the same rank as `rank`.
    */
-  constexpr Range(Kokkos::Array<std::size_t, rank> begin,
-                  Kokkos::Array<std::size_t, rank> end)
+  constexpr Range(Kokkos::Array<Index, rank> begin,
+                  Kokkos::Array<Index, rank> end)
       : mBegin(begin), mEnd(end) {}
 
   /**
@@ -45,8 +86,7 @@ public:
    * @param begin Begin index.
    * @param end End index.
    */
-  constexpr Range(std::size_t begin, std::size_t end)
-      : mBegin({begin}), mEnd({end}) {}
+  constexpr Range(Index begin, Index end) : mBegin({begin}), mEnd({end}) {}
 
   /**
    * Getter for the array containing begin coordinates.
@@ -65,6 +105,14 @@ public:
    * @return Rank of the range.
    */
   static int constexpr getRank() { return mRank; }
+
+  /**
+   * Check if index type is specified.
+   * @return True if index type is not `UnknownIndexType`.
+   */
+  static bool constexpr hasIndexType() {
+    return !std::is_same_v<IndexType, UnknownIndexType>;
+  }
 };
 
 /**
@@ -73,6 +121,205 @@ public:
 template <typename T>
 concept RangeType = std::same_as<T, typename T::RangeType>;
 
+namespace impl {
+
+/**
+ * Kernel wrapper remapping the indices of a compact range to the ones of a
+ * strided range.
+ * Arguments after the indices, such as reduction accumulators, are forwarded
+ * as is.
+ * @tparam rank Rank of the range.
+ * @tparam Index Index type of the range.
+ * @tparam Functor Kernel class, called with one index per dimension.
+ * @tparam Tag Kokkos work tag given before the indices, `void` if none.
+ */
+template <int rank, typename Index, typename Functor, typename Tag = void>
+struct StridedFunctor {
+  Functor mFunctor;
+  Kokkos::Array<Index, rank> mBegin;
+  Kokkos::Array<Index, rank> mStride;
+
+  /**
+   * Launch the kernel on a point of the compact range.
+   * @param arguments Work tag if any, then indices in the compact range,
+   * followed by the other arguments of the kernel.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments &&...arguments) const {
+    Kokkos::Array<Index, rank> point;
+    skipTag<Tag>(
+        [&](auto &&...untagged) {
+          remap<0>(point, static_cast<decltype(untagged) &&>(untagged)...);
+        },
+        static_cast<Arguments &&>(arguments)...);
+  }
+
+private:
+  /**
+   * Remap the remaining indices, then call the kernel.
+   * @tparam d Dimension of the next index.
+   * @param point Remapped indices.
+   * @param arguments Remaining arguments.
+   */
+  template <int d, typename... Arguments>
+  KOKKOS_INLINE_FUNCTION void remap(Kokkos::Array<Index, rank> &point,
+                                    Arguments &&...arguments) const {
+    if constexpr (d == rank) {
+      call(std::make_index_sequence<rank>(), point,
+           static_cast<Arguments &&>(arguments)...);
+    } else {
+      remapFirst<d>(point, static_cast<Arguments &&>(arguments)...);
+    }
+  }
+
+  /**
+   * Remap the index of a dimension.
+   * @tparam d Dimension of the index.
+   * @param point Remapped indices.
+   * @param index Index in the compact range.
+   * @param arguments Remaining arguments.
+   */
+  template <int d, typename First, typename... Arguments>
+  KOKKOS_INLINE_FUNCTION void remapFirst(Kokkos::Array<Index, rank> &point,
+                                         First const &index,
+                                         Arguments &&...arguments) const {
+    point[d] = mBegin[d] + static_cast<Index>(index) * mStride[d];
+    remap<d + 1>(point, static_cast<Arguments &&>(arguments)...);
+  }
+
+  /**
+   * Call the kernel.
+   * @param point Remapped indices.
+   * @param arguments Other arguments.
+   */
+  template <std::size_t... d, typename... Arguments>
+  KOKKOS_INLINE_FUNCTION void call(std::index_sequence<d...>,
+                                   Kokkos::Array<Index, rank> const &point,
+                                   Arguments &&...arguments) const {
+    if constexpr (std::is_void_v<Tag>) {
+      mFunctor(point[d]..., static_cast<Arguments &&>(arguments)...);
+    } else {
+      mFunctor(Tag(), point[d]..., static_cast<Arguments &&>(arguments)...);
+    }
+  }
+};
+
+} // namespace impl
+
+/**
+ * Strided range class.
+ * Range visiting one point every stride in each dimension, starting from the
+ * begin coordinates. It is launched through a compact range, the indices of
+ * which are remapped before calling the kernel, so that no iteration is
+ * wasted on inactive points.
+ * @tparam rank Rank of the range.
+ * @tparam IndexType Integral type used by Kokkos to iterate over the range.
+ * If not specified, the Kokkos default index type is used.
+ */
+template <int rank = 1, typename IndexType = UnknownIndexType>
+struct StridedRange : Range<rank, IndexType> {
+  using typename Range<rank, IndexType>::Index;
+
+  Kokkos::Array<Index, rank> mStride;
+
+  /**
+   * Marker to identify the class as a range.
+   */
+  using RangeType = StridedRange<rank, IndexType>;
+
+  /**
+   * Marker to identify the class as a strided range.
+   */
+  using StridedRangeType = StridedRange<rank, IndexType>;
+
+  StridedRange() = delete;
+
+  /**
+   * Multidimensional constructor.
+   * @param begin Array of begin coordinates.
+   * @param end Array of end coordinates.
+   * @param stride Array of strides, which must be positive.
+   */
+  constexpr StridedRange(Kokkos::Array<Index, rank> begin,
+                         Kokkos::Array<Index, rank> end,
+                         Kokkos::Array<Index, rank> stride)
+      : Range<rank, IndexType>(begin, end), mStride(stride) {
+    for (int d = 0; d < rank; d++) {
+      if (!(stride[d] > 0)) {
+        throw std::invalid_argument("Range stride must be positive");
+      }
+    }
+  }
+
+  /**
+   * Single-dimensional constructor.
+   * @param begin Begin index.
+   * @param end End index.
+   * @param stride Stride, which must be positive.
+   */
+  constexpr StridedRange(Index begin, Index end, Index stride)
+      : StridedRange(Kokkos::Array<Index, rank>{begin},
+                     Kokkos::Array<Index, rank>{end},
+                     Kokkos::Array<Index, rank>{stride}) {}
+
+  /**
+   * Getter for the array containing strides.
+   * @return Array of strides.
+   */
+  auto constexpr getStride() const { return mStride; }
+
+  /**
+   * Getter for the compact range.
+   * @return Range starting at 0, with as many points as the strided range in
+   * each dimension.
+   */
+  auto constexpr getCompactRange() const {
+    Kokkos::Array<Index, rank> begin;
+    Kokkos::Array<Index, rank> counts;
+    for (int d = 0; d < rank; d++) {
+      begin[d] = 0;
+      counts[d] = this->mEnd[d] > this->mBegin[d]
+                      ? (this->mEnd[d] - this->mBegin[d] + mStride[d] - 1) /
+                            mStride[d]
+                      : 0;
+    }
+
+    return Range<rank, IndexType>(begin, counts);
+  }
+
+  /**
+   * Wrap a kernel for the compact range.
+   * @tparam Tag Kokkos work tag given before the indices, `void` if none.
+   * @tparam ExecutionSpace Execution space of the launch.
+   * @tparam Functor Kernel class.
+   * @param functor Kernel.
+   * @return Kernel remapping the indices of the compact range.
+   */
+  template <typename Tag, typename ExecutionSpace, typename Functor>
+  auto constexpr getFunctor(Functor const &functor) const {
+    return impl::StridedFunctor<rank, Index, Functor, Tag>{
+        functor, this->mBegin, mStride};
+  }
+};
+
+/**
+ * Concept for the strided range.
+ */
+template <typename T>
+concept StridedRangeType = std::same_as<T, typename T::StridedRangeType>;
+
+/**
+ * Concept for the ranges launched through a compact range, such as strided
+ * ranges.
+ * Such a range gives the compact range with `getCompactRange`, and wraps the
+ * kernel to remap the indices of the compact range with `getFunctor`, given
+ * the work tag and the execution space of the launch.
+ */
+template <typename T>
+concept CompactedRangeType = RangeType<T> && requires(T const &range) {
+  range.getCompactRange();
+};
+
 /**
  * Tile class.
  * Can be single-dimensional (chunk size) or multidimensional, but everything
@@ -124,232 +371,1462 @@ template <typename T>
 concept TilingType = std::same_as<T, typename T::TilingType>;
 
 /**
- * Default range.
+ * Automatic tiling class.
+ * The tile is computed from the extents of the range, its rank, the memory
+ * footprint of one iteration and the sizes of the host caches, when the
+ * policy is retrieved. For non-host execution spaces, the Kokkos default tile
+ * is used instead. The tile computation is defined in `polk/auto_tiling.hpp`,
+ * which must be included to retrieve the policy (`polk/parallel.hpp` already
+ * includes it).
  */
-struct UnknownRange {};
+struct AutoTiling {
+  std::size_t mBytesPerIteration;
 
-/**
- * Default tile.
- */
-struct UnknownTiling {};
+public:
+  /**
+   * Marker to identify the class as an automatic tile.
+   */
+  using AutoTilingType = AutoTiling;
+
+  /**
+   * Constructor.
+   * @param bytesPerIteration Memory footprint of one iteration, in bytes.
+   */
+  constexpr AutoTiling(std::size_t bytesPerIteration = sizeof(double))
+      : mBytesPerIteration(bytesPerIteration) {}
+
+  /**
+   * Getter for the memory footprint of one iteration.
+   * @return Footprint in bytes.
+   */
+  std::size_t constexpr getBytesPerIteration() const {
+    return mBytesPerIteration;
+  }
+};
 
 /**
- * Default execution space.
+ * Concept for the automatic tile.
  */
-struct UnknownExecutionSpace {};
+template <typename T>
+concept AutoTilingType = std::same_as<T, typename T::AutoTilingType>;
+
+namespace impl {
 
 /**
- * Default rank.
+ * Computation of automatic tiles, defined in `polk/auto_tiling.hpp`.
+ * @tparam Tiling Automatic tile class.
  */
-int constexpr unknownRank = 0;
+template <typename Tiling> struct AutoTiler;
+
+} // namespace impl
 
 /**
- * Kokkos execution policy creator.
+ * Tuned tiling class.
+ * On the first launches of a kernel through `polk::parallel_for`, a set of
+ * candidate tiles is tried and timed, and the fastest one is kept for this
+ * label, range shape and execution space. Results are stored in a
+ * `TuningCache` and reused by later launches and later runs.
+ * When the policy is retrieved directly, the Kokkos default tile is used.
  */
-template <typename Range = UnknownRange, typename Tiling = UnknownTiling,
-          typename ExecutionSpace = UnknownExecutionSpace>
-class ExecutionParameters {
-  Range mRange;
-  Tiling mTiling;
-  ExecutionSpace mExecutionSpace;
+struct TunedTiling {
+  std::size_t mBytesPerIteration;
 
 public:
   /**
-   * Marker to identify the class as an execution policy creator.
-   */
-  using ExecutionParametersType = ExecutionParameters<Range, ExecutionSpace>;
-
-  /**
-   * Default constructor.
-   * @note This is the preferred constructor for this class.
+   * Marker to identify the class as a tuned tile.
    */
-  constexpr ExecutionParameters() = default;
+  using TunedTilingType = TunedTiling;
 
   /**
-   * Full constructor.
-   * @tparam Range Range class.
-   * @tparam Tiling Tile class.
-   * @tparam ExecutionSpace Execution space class.
-   * @param r Range parameter.
-   * @param t Tile parameter.
-   * @param es Execution space parameter.
-   * @note The user should prefer to use the default constructor.
+   * Constructor.
+   * @param bytesPerIteration Memory footprint of one iteration, in bytes.
+   * Used to add the automatic tile to the candidates.
    */
-  constexpr ExecutionParameters(Range const &r, Tiling const &t,
-                                ExecutionSpace const &es)
-      : mRange(r), mTiling(t), mExecutionSpace(es) {}
+  constexpr TunedTiling(std::size_t bytesPerIteration = sizeof(double))
+      : mBytesPerIteration(bytesPerIteration) {}
 
   /**
-   * Set the range parameter.
-   * The rank of the entered range must be the same of the tile, if it is set
-   * already.
-   * @tparam RangeIn Range class.
-   * @param r Range parameter.
-   * @return New execution policy creator.
-   * @warning This parameter cannot be set twice.
+   * Getter for the memory footprint of one iteration.
+   * @return Footprint in bytes.
    */
-  template <RangeType RangeIn> auto constexpr with(RangeIn const &r) const {
-    static_assert(std::is_same_v<Range, UnknownRange>, "Range already set");
-    if constexpr (!std::is_same_v<Tiling, UnknownTiling>) {
-      static_assert(Tiling::getRank() == RangeIn::getRank(),
-                    "Range rank and tiling rank missmatch");
-    }
-
-    return ExecutionParameters<RangeIn, Tiling, ExecutionSpace>(
-        r, mTiling, mExecutionSpace);
+  std::size_t constexpr getBytesPerIteration() const {
+    return mBytesPerIteration;
   }
+};
 
-  /**
-   * Set the tile parameter.
-   * The rank of the entered tile must be the same of the range, if it is set
-   * already.
-   * @tparam TilingIn Tile class.
-   * @param t Tile parameter.
-   * @return New execution policy creator.
-   * @warning This parameter cannot be set twice.
-   */
-  template <TilingType TilingIn> auto constexpr with(TilingIn const &t) const {
-    static_assert(std::is_same_v<Tiling, UnknownTiling>, "Tiling already set");
-    if constexpr (!std::is_same_v<Range, UnknownRange>) {
-      static_assert(Range::getRank() == TilingIn::getRank(),
-                    "Range rank and tiling rank missmatch");
-    }
+/**
+ * Concept for the tuned tile.
+ */
+template <typename T>
+concept TunedTilingType = std::same_as<T, typename T::TunedTilingType>;
 
-    return ExecutionParameters<Range, TilingIn, ExecutionSpace>(
-        mRange, t, mExecutionSpace);
-  }
+/**
+ * Schedule class.
+ * Wraps a Kokkos schedule kind, either `Kokkos::Static` or `Kokkos::Dynamic`.
+ * @tparam ScheduleKind Kokkos schedule kind.
+ */
+template <typename ScheduleKind> struct Schedule {
+  static_assert(std::is_same_v<ScheduleKind, Kokkos::Static> ||
+                    std::is_same_v<ScheduleKind, Kokkos::Dynamic>,
+                "Schedule kind must be Kokkos::Static or Kokkos::Dynamic");
 
+public:
   /**
-   * Set the execution space parameter.
-   * @tparam ExecutionSpaceIn Execution space class.
-   * @param t Tile parameter.
-   * @return New execution policy creator.
-   * @warning This parameter cannot be set twice.
+   * Marker to identify the class as a schedule.
    */
-  template <kokkos_addendum::SpaceType ExecutionSpaceIn>
-  auto constexpr with(ExecutionSpaceIn const &es) const {
-    static_assert(std::is_same_v<ExecutionSpace, UnknownExecutionSpace>,
-                  "Execution space already set");
-
-    return ExecutionParameters<Range, Tiling, ExecutionSpaceIn>(mRange, mTiling,
-                                                                es);
-  }
+  using ScheduleType = Schedule<ScheduleKind>;
 
   /**
-   * Getter for the rank.
-   * It first tries to retreive the rank of the range, then the rank of the
-   * tile.
-   * @return Rank of execution policy creator.
+   * Corresponding Kokkos schedule property.
    */
-  static int constexpr getRank() {
-    if constexpr (!std::is_same_v<Range, UnknownRange>) {
-      return Range::getRank();
-    }
+  using KokkosSchedule = Kokkos::Schedule<ScheduleKind>;
+};
 
-    if constexpr (!std::is_same_v<Tiling, UnknownTiling>) {
-      return Tiling::getRank();
-    }
+/**
+ * Concept for the schedule.
+ */
+template <typename T>
+concept ScheduleType = std::same_as<T, typename T::ScheduleType>;
 
-    return unknownRank;
-  }
+/**
+ * Iteration order class.
+ * Sets the order in which a multidimensional range is iterated, across tiles
+ * (outer direction) and within a tile (inner direction).
+ * It is ignored for single-dimensional ranges.
+ * @tparam outer Kokkos iteration direction across tiles.
+ * @tparam inner Kokkos iteration direction within a tile.
+ * @tparam rank Rank of the iteration order, `unknownRank` if it applies to
+ * any rank.
+ */
+template <Kokkos::Iterate outer, Kokkos::Iterate inner = outer,
+          int rank = unknownRank>
+struct Iterate {
+  static int constexpr mRank = rank;
 
+public:
   /**
-   * Getter for the range.
-   * @return Range parameter.
+   * Marker to identify the class as an iteration order.
    */
-  Range constexpr getRange() const { return mRange; }
+  using IterateType = Iterate<outer, inner, rank>;
 
   /**
-   * Getter for the tile.
-   * @return Tile parameter.
+   * Kokkos iteration direction within a tile.
    */
-  Tiling constexpr getTiling() const { return mTiling; }
+  static Kokkos::Iterate constexpr innerDirection = inner;
 
   /**
-   * Getter for the execution space.
-   * @return Execution space parameter.
+   * Corresponding Kokkos rank property.
+   * @tparam rankIn Rank of the policy.
    */
-  ExecutionSpace constexpr getExecutionSpace() const { return mExecutionSpace; }
+  template <int rankIn> using KokkosRank = Kokkos::Rank<rankIn, outer, inner>;
 
   /**
-   * Check if rank is specified.
-   * @return True if rank is not `unknownRank`.
+   * Getter for the rank.
+   * @return Rank of the iteration order.
    */
-  static bool constexpr hasRank() { return getRank() != unknownRank; }
+  static int constexpr getRank() { return mRank; }
+};
 
-  /**
-   * Check if range is specified.
-   * @return True if range is not `UnknownRange`.
-   */
-  static bool constexpr hasRange() {
-    return !std::is_same_v<Range, UnknownRange>;
-  }
+/**
+ * Concept for the iteration order.
+ */
+template <typename T>
+concept IterateType = std::same_as<T, typename T::IterateType>;
 
-  /**
-   * Check if tiling is specified.
-   * @return True if tiling is not `UnknownTiling`.
-   */
-  static bool constexpr hasTiling() {
-    return !std::is_same_v<Tiling, UnknownTiling>;
-  }
+/**
+ * Morton curve, or Z-order curve.
+ * Available for any rank.
+ */
+struct Morton {};
+
+/**
+ * Hilbert curve.
+ * Available for a rank of 2 only.
+ */
+struct Hilbert {};
+
+/**
+ * Tile order class.
+ * Order in which the tiles of a multidimensional range are traversed, along
+ * a space-filling curve, in order to keep neighbouring tiles close in time.
+ * The tiles are launched through a single-dimensional policy by
+ * `polk::parallel_for`. When the policy is retrieved directly, the tile order
+ * is not used.
+ * @tparam Curve Space-filling curve, either `polk::Morton` or
+ * `polk::Hilbert`.
+ */
+template <typename Curve> struct TileOrder {
+  static_assert(std::is_same_v<Curve, Morton> ||
+                    std::is_same_v<Curve, Hilbert>,
+                "Tile order must be Morton or Hilbert");
 
+public:
   /**
-   * Check if execution space is specified.
-   * @return True if execution space is not `UnknownExecutionSpace`.
+   * Marker to identify the class as a tile order.
    */
-  static bool constexpr hasExecutionSpace() {
-    return !std::is_same_v<ExecutionSpace, UnknownExecutionSpace>;
-  }
+  using TileOrderType = TileOrder<Curve>;
 
   /**
-   * Retrieve a Kokkos execution policy.
-   * @return Kokkos execution policy. May be a `Kokkos::RangePolicy` for
-   * single-dimensional range and tile, or a `Kokkos::MDRangePolicy` for
-   * multidimensional ones.
-   * @warning The range (and the rank) must have been set before calling this
-   * method.
+   * Space-filling curve.
    */
-  auto constexpr getPolicy() const {
-    // parameters that must be set
-    static_assert(hasRank(), "No rank set");
-    static_assert(hasRange(), "No range set");
+  using CurveType = Curve;
+};
 
-    if constexpr (getRank() > 1) {
-      if constexpr (std::is_same_v<ExecutionSpace, UnknownExecutionSpace>) {
-        if constexpr (std::is_same_v<Tiling, UnknownTiling>) {
-          return Kokkos::MDRangePolicy(mRange.getBegin(), mRange.getEnd());
-        } else {
-          return Kokkos::MDRangePolicy(mRange.getBegin(), mRange.getEnd(),
-                                       mTiling.getTile());
+/**
+ * Concept for the tile order.
+ */
+template <typename T>
+concept TileOrderType = std::same_as<T, typename T::TileOrderType>;
+
+/**
+ * Default tile order.
+ */
+struct UnknownTileOrder {};
+
+/**
+ * Vectorization class.
+ * On execution spaces that can access the host memory, `polk::parallel_for`
+ * only parallelizes the outer dimensions of a multidimensional range, the
+ * innermost one being iterated by a contiguous loop marked for SIMD
+ * vectorization. The kernel is still called with one index per dimension.
+ * It is ignored by other execution spaces, by reductions and scans, and when
+ * the policy is retrieved directly.
+ */
+struct Vectorize {
+  /**
+   * Marker to identify the class as a vectorization.
+   */
+  using VectorizeType = Vectorize;
+};
+
+/**
+ * Concept for the vectorization.
+ */
+template <typename T>
+concept VectorizeType = std::same_as<T, typename T::VectorizeType>;
+
+/**
+ * Default vectorization.
+ */
+struct UnknownVectorize {};
+
+namespace impl {
+
+/**
+ * Kokkos iteration direction matching the contiguous direction of a layout.
+ * @tparam Layout Kokkos layout.
+ * @return `Kokkos::Iterate::Left` for `Kokkos::LayoutLeft`,
+ * `Kokkos::Iterate::Right` for `Kokkos::LayoutRight`, and
+ * `Kokkos::Iterate::Default` otherwise.
+ */
+template <typename Layout> Kokkos::Iterate constexpr getIterateDirection() {
+  if constexpr (std::is_same_v<Layout, Kokkos::LayoutLeft>) {
+    return Kokkos::Iterate::Left;
+  } else if constexpr (std::is_same_v<Layout, Kokkos::LayoutRight>) {
+    return Kokkos::Iterate::Right;
+  } else {
+    return Kokkos::Iterate::Default;
+  }
+}
+
+} // namespace impl
+
+/**
+ * Iteration order matching the layout of a view.
+ * The contiguous dimension of the view is iterated innermost, and the rank of
+ * the iteration order is the rank of the view.
+ * @tparam View Kokkos view class.
+ */
+template <typename View>
+using IterateLike =
+    Iterate<impl::getIterateDirection<typename View::array_layout>(),
+            impl::getIterateDirection<typename View::array_layout>(),
+            static_cast<int>(View::rank)>;
+
+/**
+ * Create an iteration order matching the layout of a view.
+ * @tparam View Kokkos view class.
+ * @param view Kokkos view.
+ * @return Iteration order.
+ */
+template <typename View>
+auto constexpr iterateLike([[maybe_unused]] View const &view) {
+  return IterateLike<View>();
+}
+
+/**
+ * Default range.
+ */
+struct UnknownRange {};
+
+/**
+ * Default tile.
+ */
+struct UnknownTiling {};
+
+/**
+ * Default execution space.
+ */
+struct UnknownExecutionSpace {};
+
+/**
+ * Default schedule.
+ */
+struct UnknownSchedule {};
+
+/**
+ * Default iteration order.
+ */
+struct UnknownIterate {};
+
+namespace impl {
+
+/**
+ * List of types.
+ */
+template <typename... Types> struct TypeList {};
+
+/**
+ * Kokkos property corresponding to a parameter.
+ * Unknown parameters have no property, which is represented by `void`.
+ */
+template <typename Parameter> struct KokkosProperty {
+  using type = void;
+};
+
+template <kokkos_addendum::SpaceType ExecutionSpace>
+struct KokkosProperty<ExecutionSpace> {
+  using type = ExecutionSpace;
+};
+
+template <RangeType Range> struct KokkosProperty<Range> {
+  using type = typename Range::KokkosIndexType;
+};
+
+template <ScheduleType Schedule> struct KokkosProperty<Schedule> {
+  using type = typename Schedule::KokkosSchedule;
+};
+
+template <LaunchBoundsType LaunchBounds> struct KokkosProperty<LaunchBounds> {
+  using type = typename LaunchBounds::KokkosLaunchBounds;
+};
+
+template <WorkTagType WorkTag> struct KokkosProperty<WorkTag> {
+  using type = typename WorkTag::KokkosWorkTag;
+};
+
+template <typename Parameter>
+using KokkosPropertyType = typename KokkosProperty<Parameter>::type;
+
+/**
+ * Kokkos rank property corresponding to an iteration order.
+ * Unknown iteration orders use the Kokkos default directions.
+ */
+template <typename Iterate, int rank> struct KokkosRank {
+  using type = Kokkos::Rank<rank>;
+};
+
+template <IterateType Iterate, int rank> struct KokkosRank<Iterate, rank> {
+  using type = typename Iterate::template KokkosRank<rank>;
+};
+
+template <typename Iterate, int rank>
+using KokkosRankType = typename KokkosRank<Iterate, rank>::type;
+
+/**
+ * Position of the parameters in the template parameters of
+ * `ExecutionParameters`.
+ */
+enum ParameterIndex : std::size_t {
+  rangeIndex,
+  tilingIndex,
+  executionSpaceIndex,
+  scheduleIndex,
+  iterateIndex,
+  leagueIndex,
+  teamSizeIndex,
+  vectorLengthIndex,
+  scratchLevel0Index,
+  scratchLevel1Index,
+  tileOrderIndex,
+  reducerIndex,
+  launchBoundsIndex,
+  occupancyIndex,
+  workTagIndex,
+  vectorizeIndex,
+};
+
+/**
+ * Select one of two values at compile time.
+ * @tparam isFirst If the first value is selected.
+ * @param first First value.
+ * @param second Second value.
+ * @return Selected value.
+ */
+template <bool isFirst, typename First, typename Second>
+auto constexpr const &select(First const &first, Second const &second) {
+  if constexpr (isFirst) {
+    return first;
+  } else {
+    return second;
+  }
+}
+
+/**
+ * Check if the first dimension is iterated innermost.
+ * @tparam Iterate Iteration order class.
+ * @return True if the iteration order is set to `Kokkos::Iterate::Left`
+ * within a tile.
+ */
+template <typename Iterate> bool constexpr isInnerLeft() {
+  if constexpr (IterateType<Iterate>) {
+    return Iterate::innerDirection == Kokkos::Iterate::Left;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * Kokkos policy builder.
+ * Instantiate a Kokkos policy template with the given properties, skipping
+ * the `void` ones so that Kokkos defaults apply.
+ */
+template <template <typename...> typename Policy, typename Kept,
+          typename... Properties>
+struct PolicyBuilder;
+
+template <template <typename...> typename Policy, typename... Kept>
+struct PolicyBuilder<Policy, TypeList<Kept...>> {
+  using type = Policy<Kept...>;
+};
+
+template <template <typename...> typename Policy, typename... Kept,
+          typename Property, typename... Properties>
+struct PolicyBuilder<Policy, TypeList<Kept...>, Property, Properties...> {
+  using type = typename PolicyBuilder<
+      Policy,
+      std::conditional_t<std::is_void_v<Property>, TypeList<Kept...>,
+                         TypeList<Kept..., Property>>,
+      Properties...>::type;
+};
+
+template <template <typename...> typename Policy, typename... Properties>
+using PolicyWith =
+    typename PolicyBuilder<Policy, TypeList<>, Properties...>::type;
+
+/**
+ * Get the extents of a range.
+ * @tparam Range Range class.
+ * @param range Range.
+ * @return Extents, 0 for empty dimensions. Extents of a strided or weighted
+ * range are the ones of its compact range.
+ */
+template <RangeType Range>
+Kokkos::Array<std::size_t, Range::getRank()> getExtents(Range const &range) {
+  if constexpr (CompactedRangeType<Range>) {
+    return getExtents(range.getCompactRange());
+  }
+
+  Kokkos::Array<std::size_t, Range::getRank()> extents;
+  for (int d = 0; d < Range::getRank(); d++) {
+    extents[d] = range.getEnd()[d] > range.getBegin()[d]
+                     ? range.getEnd()[d] - range.getBegin()[d]
+                     : 0;
+  }
+
+  return extents;
+}
+
+} // namespace impl
+
+/**
+ * Kokkos execution policy creator.
+ */
+template <typename Range = UnknownRange, typename Tiling = UnknownTiling,
+          typename ExecutionSpace = UnknownExecutionSpace,
+          typename Schedule = UnknownSchedule,
+          typename Iterate = UnknownIterate, typename League = UnknownLeague,
+          typename TeamSize = UnknownTeamSize,
+          typename VectorLength = UnknownVectorLength,
+          typename ScratchLevel0 = UnknownScratch,
+          typename ScratchLevel1 = UnknownScratch,
+          typename TileOrder = UnknownTileOrder,
+          typename Reducer = UnknownReducer,
+          typename LaunchBounds = UnknownLaunchBounds,
+          typename Occupancy = UnknownOccupancy,
+          typename WorkTag = UnknownWorkTag,
+          typename Vectorize = UnknownVectorize>
+class ExecutionParameters {
+  Range mRange;
+  Tiling mTiling;
+  ExecutionSpace mExecutionSpace;
+  Schedule mSchedule;
+  Iterate mIterate;
+  League mLeague;
+  TeamSize mTeamSize;
+  VectorLength mVectorLength;
+  ScratchLevel0 mScratchLevel0;
+  ScratchLevel1 mScratchLevel1;
+  TileOrder mTileOrder;
+  Reducer mReducer;
+  LaunchBounds mLaunchBounds;
+  Occupancy mOccupancy;
+  WorkTag mWorkTag;
+  Vectorize mVectorize;
+
+public:
+  /**
+   * Marker to identify the class as an execution policy creator.
+   */
+  using ExecutionParametersType =
+      ExecutionParameters<Range, Tiling, ExecutionSpace, Schedule, Iterate,
+                          League, TeamSize, VectorLength, ScratchLevel0,
+                          ScratchLevel1, TileOrder, Reducer, LaunchBounds,
+                          Occupancy, WorkTag, Vectorize>;
+
+  /**
+   * Default constructor.
+   * @note This is the preferred constructor for this class.
+   */
+  constexpr ExecutionParameters() = default;
+
+  /**
+   * Full constructor.
+   * @tparam Range Range class.
+   * @tparam Tiling Tile class.
+   * @tparam ExecutionSpace Execution space class.
+   * @tparam Schedule Schedule class.
+   * @tparam Iterate Iteration order class.
+   * @tparam League League class.
+   * @tparam TeamSize Team size class.
+   * @tparam VectorLength Vector length class.
+   * @tparam ScratchLevel0 Level 0 scratch memory class.
+   * @tparam ScratchLevel1 Level 1 scratch memory class.
+   * @tparam TileOrder Tile order class.
+   * @tparam Reducer Reducer class.
+   * @tparam LaunchBounds Launch bounds class.
+   * @tparam Occupancy Occupancy class.
+   * @tparam WorkTag Work tag class.
+   * @tparam Vectorize Vectorization class.
+   * @param r Range parameter.
+   * @param t Tile parameter.
+   * @param es Execution space parameter.
+   * @param s Schedule parameter.
+   * @param i Iteration order parameter.
+   * @param l League parameter.
+   * @param ts Team size parameter.
+   * @param vl Vector length parameter.
+   * @param s0 Level 0 scratch memory parameter.
+   * @param s1 Level 1 scratch memory parameter.
+   * @param to Tile order parameter.
+   * @param rd Reducer parameter.
+   * @param lb Launch bounds parameter.
+   * @param o Occupancy parameter.
+   * @param wt Work tag parameter.
+   * @param v Vectorization parameter.
+   * @note The user should prefer to use the default constructor.
+   */
+  constexpr ExecutionParameters(Range const &r, Tiling const &t,
+                                ExecutionSpace const &es, Schedule const &s,
+                                Iterate const &i, League const &l,
+                                TeamSize const &ts, VectorLength const &vl,
+                                ScratchLevel0 const &s0,
+                                ScratchLevel1 const &s1, TileOrder const &to,
+                                Reducer const &rd, LaunchBounds const &lb,
+                                Occupancy const &o, WorkTag const &wt,
+                                Vectorize const &v)
+      : mRange(r), mTiling(t), mExecutionSpace(es), mSchedule(s), mIterate(i),
+        mLeague(l), mTeamSize(ts), mVectorLength(vl), mScratchLevel0(s0),
+        mScratchLevel1(s1), mTileOrder(to), mReducer(rd), mLaunchBounds(lb),
+        mOccupancy(o), mWorkTag(wt), mVectorize(v) {}
+
+  /**
+   * Set the range parameter.
+   * The rank of the entered range must be the same of the tile and of the
+   * iteration order, if they are set already.
+   * @tparam RangeIn Range class.
+   * @param r Range parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a league.
+   */
+  template <RangeType RangeIn> auto constexpr with(RangeIn const &r) const {
+    static_assert(std::is_same_v<Range, UnknownRange>, "Range already set");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Range cannot be set with a league");
+    if constexpr (TilingType<Tiling>) {
+      static_assert(Tiling::getRank() == RangeIn::getRank(),
+                    "Range rank and tiling rank missmatch");
+    }
+    if constexpr (!std::is_same_v<Iterate, UnknownIterate>) {
+      static_assert(Iterate::getRank() == unknownRank ||
+                        Iterate::getRank() == RangeIn::getRank(),
+                    "Range rank and iteration order rank missmatch");
+    }
+
+    return set<impl::rangeIndex>(r);
+  }
+
+  /**
+   * Set the tile parameter.
+   * The rank of the entered tile must be the same of the range and of the
+   * iteration order, if they are set already.
+   * @tparam TilingIn Tile class.
+   * @param t Tile parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a league.
+   */
+  template <TilingType TilingIn> auto constexpr with(TilingIn const &t) const {
+    static_assert(std::is_same_v<Tiling, UnknownTiling>, "Tiling already set");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Tiling cannot be set with a league");
+    if constexpr (!std::is_same_v<Range, UnknownRange>) {
+      static_assert(Range::getRank() == TilingIn::getRank(),
+                    "Range rank and tiling rank missmatch");
+    }
+    if constexpr (!std::is_same_v<Iterate, UnknownIterate>) {
+      static_assert(Iterate::getRank() == unknownRank ||
+                        Iterate::getRank() == TilingIn::getRank(),
+                    "Tiling rank and iteration order rank missmatch");
+    }
+
+    return set<impl::tilingIndex>(t);
+  }
+
+  /**
+   * Set the tile parameter to an automatic tile.
+   * @tparam AutoTilingIn Automatic tile class.
+   * @param t Automatic tile parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a league.
+   */
+  template <AutoTilingType AutoTilingIn>
+  auto constexpr with(AutoTilingIn const &t) const {
+    static_assert(std::is_same_v<Tiling, UnknownTiling>, "Tiling already set");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Tiling cannot be set with a league");
+
+    return set<impl::tilingIndex>(t);
+  }
+
+  /**
+   * Set the tile parameter to a tuned tile.
+   * @tparam TunedTilingIn Tuned tile class.
+   * @param t Tuned tile parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a league.
+   */
+  template <TunedTilingType TunedTilingIn>
+  auto constexpr with(TunedTilingIn const &t) const {
+    static_assert(std::is_same_v<Tiling, UnknownTiling>, "Tiling already set");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Tiling cannot be set with a league");
+    static_assert(std::is_same_v<TileOrder, UnknownTileOrder>,
+                  "Tuned tiling cannot be set with a tile order");
+
+    return set<impl::tilingIndex>(t);
+  }
+
+  /**
+   * Replace the tile parameter.
+   * Contrary to `with`, the tile may already be set, in which case it is
+   * overridden. The rank of the entered tile must be the same of the range
+   * and of the iteration order, if they are set.
+   * @tparam TilingIn Tile class.
+   * @param t Tile parameter.
+   * @return New execution policy creator.
+   */
+  template <TilingType TilingIn>
+  auto constexpr replace(TilingIn const &t) const {
+    return set<impl::tilingIndex>(UnknownTiling()).with(t);
+  }
+
+  /**
+   * Replace the range parameter.
+   * Contrary to `with`, the range may already be set, in which case it is
+   * overridden. The rank of the entered range must be the same of the tile
+   * and of the iteration order, if they are set.
+   * @tparam RangeIn Range class.
+   * @param r Range parameter.
+   * @return New execution policy creator.
+   */
+  template <RangeType RangeIn> auto constexpr replace(RangeIn const &r) const {
+    return set<impl::rangeIndex>(UnknownRange()).with(r);
+  }
+
+  /**
+   * Replace the execution space parameter.
+   * Contrary to `with`, the execution space may already be set, in which case
+   * it is overridden.
+   * @tparam ExecutionSpaceIn Execution space class.
+   * @param es Execution space parameter.
+   * @return New execution policy creator.
+   */
+  template <kokkos_addendum::SpaceType ExecutionSpaceIn>
+  auto constexpr replace(ExecutionSpaceIn const &es) const {
+    return set<impl::executionSpaceIndex>(UnknownExecutionSpace()).with(es);
+  }
+
+  /**
+   * Replace the work tag parameter.
+   * Contrary to `with`, the work tag may already be set, in which case it is
+   * overridden. This re-targets the parameters to another phase of a
+   * functor, all the other parameters being kept.
+   * @tparam WorkTagIn Work tag class.
+   * @param wt Work tag parameter.
+   * @return New execution policy creator.
+   */
+  template <WorkTagType WorkTagIn>
+  auto constexpr replace(WorkTagIn const &wt) const {
+    return set<impl::workTagIndex>(UnknownWorkTag()).with(wt);
+  }
+
+  /**
+   * Set the execution space parameter.
+   * @tparam ExecutionSpaceIn Execution space class.
+   * @param t Tile parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <kokkos_addendum::SpaceType ExecutionSpaceIn>
+  auto constexpr with(ExecutionSpaceIn const &es) const {
+    static_assert(std::is_same_v<ExecutionSpace, UnknownExecutionSpace>,
+                  "Execution space already set");
+
+    return set<impl::executionSpaceIndex>(es);
+  }
+
+  /**
+   * Set the schedule parameter.
+   * @tparam ScheduleIn Schedule class.
+   * @param s Schedule parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <ScheduleType ScheduleIn>
+  auto constexpr with(ScheduleIn const &s) const {
+    static_assert(std::is_same_v<Schedule, UnknownSchedule>,
+                  "Schedule already set");
+
+    return set<impl::scheduleIndex>(s);
+  }
+
+  /**
+   * Set the iteration order parameter.
+   * The rank of the entered iteration order must be the same of the range and
+   * of the tile, if they are set already and if the iteration order has a
+   * rank.
+   * @tparam IterateIn Iteration order class.
+   * @param i Iteration order parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <IterateType IterateIn>
+  auto constexpr with(IterateIn const &i) const {
+    static_assert(std::is_same_v<Iterate, UnknownIterate>,
+                  "Iteration order already set");
+    if constexpr (IterateIn::getRank() != unknownRank) {
+      if constexpr (!std::is_same_v<Range, UnknownRange>) {
+        static_assert(Range::getRank() == IterateIn::getRank(),
+                      "Range rank and iteration order rank missmatch");
+      }
+      if constexpr (TilingType<Tiling>) {
+        static_assert(Tiling::getRank() == IterateIn::getRank(),
+                      "Tiling rank and iteration order rank missmatch");
+      }
+    }
+
+    return set<impl::iterateIndex>(i);
+  }
+
+  /**
+   * Set the league parameter.
+   * The execution policy creator then builds a team policy.
+   * @tparam LeagueIn League class.
+   * @param l League parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a range or a tile.
+   */
+  template <LeagueType LeagueIn> auto constexpr with(LeagueIn const &l) const {
+    static_assert(std::is_same_v<League, UnknownLeague>, "League already set");
+    static_assert(std::is_same_v<Range, UnknownRange>,
+                  "League cannot be set with a range");
+    static_assert(std::is_same_v<Tiling, UnknownTiling>,
+                  "League cannot be set with a tiling");
+    static_assert(std::is_same_v<TileOrder, UnknownTileOrder>,
+                  "League cannot be set with a tile order");
+    static_assert(std::is_same_v<Vectorize, UnknownVectorize>,
+                  "League cannot be set with vectorization");
+
+    return set<impl::leagueIndex>(l);
+  }
+
+  /**
+   * Set the team size parameter.
+   * @tparam TeamSizeIn Team size class.
+   * @param ts Team size parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <TeamSizeType TeamSizeIn>
+  auto constexpr with(TeamSizeIn const &ts) const {
+    static_assert(std::is_same_v<TeamSize, UnknownTeamSize>,
+                  "Team size already set");
+
+    return set<impl::teamSizeIndex>(ts);
+  }
+
+  /**
+   * Set the vector length parameter.
+   * @tparam VectorLengthIn Vector length class.
+   * @param vl Vector length parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <VectorLengthType VectorLengthIn>
+  auto constexpr with(VectorLengthIn const &vl) const {
+    static_assert(std::is_same_v<VectorLength, UnknownVectorLength>,
+                  "Vector length already set");
+
+    return set<impl::vectorLengthIndex>(vl);
+  }
+
+  /**
+   * Set the scratch memory parameter of a level.
+   * @tparam ScratchIn Scratch memory class.
+   * @param sm Scratch memory parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice for the same level.
+   */
+  template <ScratchType ScratchIn>
+  auto constexpr with(ScratchIn const &sm) const {
+    if constexpr (ScratchIn::getLevel() == 0) {
+      static_assert(std::is_same_v<ScratchLevel0, UnknownScratch>,
+                    "Scratch level 0 already set");
+
+      return set<impl::scratchLevel0Index>(sm);
+    } else {
+      static_assert(std::is_same_v<ScratchLevel1, UnknownScratch>,
+                    "Scratch level 1 already set");
+
+      return set<impl::scratchLevel1Index>(sm);
+    }
+  }
+
+  /**
+   * Set the tile order parameter.
+   * @tparam TileOrderIn Tile order class.
+   * @param to Tile order parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a tuned tile or a
+   * league.
+   */
+  template <TileOrderType TileOrderIn>
+  auto constexpr with(TileOrderIn const &to) const {
+    static_assert(std::is_same_v<TileOrder, UnknownTileOrder>,
+                  "Tile order already set");
+    static_assert(!TunedTilingType<Tiling>,
+                  "Tile order cannot be set with a tuned tiling");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Tile order cannot be set with a league");
+
+    return set<impl::tileOrderIndex>(to);
+  }
+
+  /**
+   * Set the reducer parameter.
+   * It is only used by `polk::parallel_reduce`.
+   * @tparam ReducerIn Reducer class.
+   * @param rd Reducer parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <ReducerType ReducerIn>
+  auto constexpr with(ReducerIn const &rd) const {
+    static_assert(std::is_same_v<Reducer, UnknownReducer>,
+                  "Reducer already set");
+
+    return set<impl::reducerIndex>(rd);
+  }
+
+  /**
+   * Set the launch bounds parameter.
+   * @tparam LaunchBoundsIn Launch bounds class.
+   * @param lb Launch bounds parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <LaunchBoundsType LaunchBoundsIn>
+  auto constexpr with(LaunchBoundsIn const &lb) const {
+    static_assert(std::is_same_v<LaunchBounds, UnknownLaunchBounds>,
+                  "Launch bounds already set");
+
+    return set<impl::launchBoundsIndex>(lb);
+  }
+
+  /**
+   * Set the occupancy parameter.
+   * @tparam OccupancyIn Occupancy class.
+   * @param o Occupancy parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <OccupancyType OccupancyIn>
+  auto constexpr with(OccupancyIn const &o) const {
+    static_assert(std::is_same_v<Occupancy, UnknownOccupancy>,
+                  "Occupancy already set");
+
+    return set<impl::occupancyIndex>(o);
+  }
+
+  /**
+   * Set the work tag parameter.
+   * @tparam WorkTagIn Work tag class.
+   * @param wt Work tag parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice.
+   */
+  template <WorkTagType WorkTagIn>
+  auto constexpr with(WorkTagIn const &wt) const {
+    static_assert(std::is_same_v<WorkTag, UnknownWorkTag>,
+                  "Work tag already set");
+
+    return set<impl::workTagIndex>(wt);
+  }
+
+  /**
+   * Set the vectorization parameter.
+   * @tparam VectorizeIn Vectorization class.
+   * @param v Vectorization parameter.
+   * @return New execution policy creator.
+   * @warning This parameter cannot be set twice, nor with a league.
+   */
+  template <VectorizeType VectorizeIn>
+  auto constexpr with(VectorizeIn const &v) const {
+    static_assert(std::is_same_v<Vectorize, UnknownVectorize>,
+                  "Vectorization already set");
+    static_assert(std::is_same_v<League, UnknownLeague>,
+                  "Vectorization cannot be set with a league");
+
+    return set<impl::vectorizeIndex>(v);
+  }
+
+  /**
+   * Getter for the rank.
+   * It first tries to retreive the rank of the range, then the rank of the
+   * tile, then the rank of the iteration order.
+   * @return Rank of execution policy creator.
+   */
+  static int constexpr getRank() {
+    if constexpr (!std::is_same_v<Range, UnknownRange>) {
+      return Range::getRank();
+    }
+
+    if constexpr (TilingType<Tiling>) {
+      return Tiling::getRank();
+    }
+
+    if constexpr (!std::is_same_v<Iterate, UnknownIterate>) {
+      return Iterate::getRank();
+    }
+
+    return unknownRank;
+  }
+
+  /**
+   * Getter for the range.
+   * @return Range parameter.
+   */
+  Range constexpr getRange() const { return mRange; }
+
+  /**
+   * Getter for the tile.
+   * @return Tile parameter.
+   */
+  Tiling constexpr getTiling() const { return mTiling; }
+
+  /**
+   * Getter for the execution space.
+   * @return Execution space parameter.
+   */
+  ExecutionSpace constexpr getExecutionSpace() const { return mExecutionSpace; }
+
+  /**
+   * Getter for the schedule.
+   * @return Schedule parameter.
+   */
+  Schedule constexpr getSchedule() const { return mSchedule; }
+
+  /**
+   * Getter for the iteration order.
+   * @return Iteration order parameter.
+   */
+  Iterate constexpr getIterate() const { return mIterate; }
+
+  /**
+   * Getter for the league.
+   * @return League parameter.
+   */
+  League constexpr getLeague() const { return mLeague; }
+
+  /**
+   * Getter for the team size.
+   * @return Team size parameter.
+   */
+  TeamSize constexpr getTeamSize() const { return mTeamSize; }
+
+  /**
+   * Getter for the vector length.
+   * @return Vector length parameter.
+   */
+  VectorLength constexpr getVectorLength() const { return mVectorLength; }
+
+  /**
+   * Getter for the tile order.
+   * @return Tile order parameter.
+   */
+  TileOrder constexpr getTileOrder() const { return mTileOrder; }
+
+  /**
+   * Getter for the reducer.
+   * @return Reducer parameter.
+   */
+  Reducer constexpr getReducer() const { return mReducer; }
+
+  /**
+   * Getter for the launch bounds.
+   * @return Launch bounds parameter.
+   */
+  LaunchBounds constexpr getLaunchBounds() const { return mLaunchBounds; }
+
+  /**
+   * Getter for the occupancy.
+   * @return Occupancy parameter.
+   */
+  Occupancy constexpr getOccupancy() const { return mOccupancy; }
+
+  /**
+   * Getter for the work tag.
+   * @return Work tag parameter.
+   */
+  WorkTag constexpr getWorkTag() const { return mWorkTag; }
+
+  /**
+   * Getter for the vectorization.
+   * @return Vectorization parameter.
+   */
+  Vectorize constexpr getVectorize() const { return mVectorize; }
+
+  /**
+   * Getter for the scratch memory of a level.
+   * @tparam level Scratch level.
+   * @return Scratch memory parameter.
+   */
+  template <int level> auto constexpr getScratch() const {
+    static_assert(level == 0 || level == 1, "Scratch level must be 0 or 1");
+
+    if constexpr (level == 0) {
+      return mScratchLevel0;
+    } else {
+      return mScratchLevel1;
+    }
+  }
+
+  /**
+   * Check if rank is specified.
+   * @return True if rank is not `unknownRank`.
+   */
+  static bool constexpr hasRank() { return getRank() != unknownRank; }
+
+  /**
+   * Check if range is specified.
+   * @return True if range is not `UnknownRange`.
+   */
+  static bool constexpr hasRange() {
+    return !std::is_same_v<Range, UnknownRange>;
+  }
+
+  /**
+   * Check if tiling is specified.
+   * @return True if tiling is not `UnknownTiling`.
+   */
+  static bool constexpr hasTiling() {
+    return !std::is_same_v<Tiling, UnknownTiling>;
+  }
+
+  /**
+   * Check if execution space is specified.
+   * @return True if execution space is not `UnknownExecutionSpace`.
+   */
+  static bool constexpr hasExecutionSpace() {
+    return !std::is_same_v<ExecutionSpace, UnknownExecutionSpace>;
+  }
+
+  /**
+   * Check if schedule is specified.
+   * @return True if schedule is not `UnknownSchedule`.
+   */
+  static bool constexpr hasSchedule() {
+    return !std::is_same_v<Schedule, UnknownSchedule>;
+  }
+
+  /**
+   * Check if iteration order is specified.
+   * @return True if iteration order is not `UnknownIterate`.
+   */
+  static bool constexpr hasIterate() {
+    return !std::is_same_v<Iterate, UnknownIterate>;
+  }
+
+  /**
+   * Check if league is specified.
+   * @return True if league is not `UnknownLeague`.
+   */
+  static bool constexpr hasLeague() {
+    return !std::is_same_v<League, UnknownLeague>;
+  }
+
+  /**
+   * Check if team size is specified.
+   * @return True if team size is not `UnknownTeamSize`.
+   */
+  static bool constexpr hasTeamSize() {
+    return !std::is_same_v<TeamSize, UnknownTeamSize>;
+  }
+
+  /**
+   * Check if vector length is specified.
+   * @return True if vector length is not `UnknownVectorLength`.
+   */
+  static bool constexpr hasVectorLength() {
+    return !std::is_same_v<VectorLength, UnknownVectorLength>;
+  }
+
+  /**
+   * Check if tile order is specified.
+   * @return True if tile order is not `UnknownTileOrder`.
+   */
+  static bool constexpr hasTileOrder() {
+    return !std::is_same_v<TileOrder, UnknownTileOrder>;
+  }
+
+  /**
+   * Check if reducer is specified.
+   * @return True if reducer is not `UnknownReducer`.
+   */
+  static bool constexpr hasReducer() {
+    return !std::is_same_v<Reducer, UnknownReducer>;
+  }
+
+  /**
+   * Check if launch bounds are specified.
+   * @return True if launch bounds are not `UnknownLaunchBounds`.
+   */
+  static bool constexpr hasLaunchBounds() {
+    return !std::is_same_v<LaunchBounds, UnknownLaunchBounds>;
+  }
+
+  /**
+   * Check if occupancy is specified.
+   * @return True if occupancy is not `UnknownOccupancy`.
+   */
+  static bool constexpr hasOccupancy() {
+    return !std::is_same_v<Occupancy, UnknownOccupancy>;
+  }
+
+  /**
+   * Check if work tag is specified.
+   * @return True if work tag is not `UnknownWorkTag`.
+   */
+  static bool constexpr hasWorkTag() {
+    return !std::is_same_v<WorkTag, UnknownWorkTag>;
+  }
+
+  /**
+   * Check if vectorization is specified.
+   * @return True if vectorization is not `UnknownVectorize`.
+   */
+  static bool constexpr hasVectorize() {
+    return !std::is_same_v<Vectorize, UnknownVectorize>;
+  }
+
+  /**
+   * Check if scratch memory is specified for a level.
+   * @tparam level Scratch level.
+   * @return True if scratch memory of this level is not `UnknownScratch`.
+   */
+  template <int level> static bool constexpr hasScratch() {
+    static_assert(level == 0 || level == 1, "Scratch level must be 0 or 1");
+
+    if constexpr (level == 0) {
+      return !std::is_same_v<ScratchLevel0, UnknownScratch>;
+    } else {
+      return !std::is_same_v<ScratchLevel1, UnknownScratch>;
+    }
+  }
+
+  /**
+   * Retrieve a Kokkos execution policy.
+   * @return Kokkos execution policy. May be a `Kokkos::TeamPolicy` if a league
+   * is set, a `Kokkos::RangePolicy` for single-dimensional range and tile, or
+   * a `Kokkos::MDRangePolicy` for multidimensional ones. The execution space,
+   * the schedule and the index type of the range are forwarded as policy
+   * properties if they are set, and the iteration order is forwarded to the
+   * rank of multidimensional policies. Launch bounds and the work tag are
+   * forwarded as policy properties, and occupancy with
+   * `Kokkos::Experimental::prefer`.
+   * An automatic tile is computed at this point.
+   * A strided or weighted range gives the policy of its compact range, and
+   * the kernel must be wrapped with `getFunctor`.
+   * @warning The range (and the rank), or the league, must have been set
+   * before calling this method.
+   */
+  auto constexpr getPolicy() const {
+    // parameters that must be set
+    static_assert(hasLeague() || hasRank(), "No rank set");
+    static_assert(hasLeague() || hasRange(), "No range set");
+    static_assert(hasLeague() || !hasTeamParameters(), "No league set");
+
+    if constexpr (CompactedRangeType<Range>) {
+      return replace(mRange.getCompactRange()).getPolicy();
+    } else if constexpr (hasOccupancy()) {
+      return Kokkos::Experimental::prefer(
+          getBasePolicy(), Kokkos::Experimental::DesiredOccupancy(
+                               mOccupancy.getPercent()));
+    } else {
+      return getBasePolicy();
+    }
+  }
+
+  /**
+   * Wrap a kernel for the policy.
+   * @tparam Functor Kernel class.
+   * @param functor Kernel.
+   * @return Kernel remapping the indices of the compact range to the ones of
+   * the range if it is strided or weighted, the kernel itself otherwise.
+   */
+  template <typename Functor>
+  auto constexpr getFunctor(Functor const &functor) const {
+    if constexpr (CompactedRangeType<Range>) {
+      using Space = typename decltype(getPolicy())::execution_space;
+      return mRange.template getFunctor<impl::KokkosPropertyType<WorkTag>,
+                                        Space>(functor);
+    } else {
+      return functor;
+    }
+  }
+
+  /**
+   * Check if a tile is given to the policy.
+   * Automatic tiles are only computed for execution spaces that can access
+   * the host memory, and tuned tiles are only given when launching with
+   * `polk::parallel_for`.
+   * @return True if a tile is given.
+   */
+  static bool constexpr hasPolicyTile() {
+    if constexpr (TunedTilingType<Tiling>) {
+      return false;
+    } else if constexpr (AutoTilingType<Tiling>) {
+      return Kokkos::SpaceAccessibility<PolicyExecutionSpace,
+                                        Kokkos::HostSpace>::accessible;
+    } else {
+      return hasTiling();
+    }
+  }
+
+  /**
+   * Getter for the tile given to the policy.
+   * @return Tile parameter, or computed tile for an automatic tile.
+   */
+  auto getPolicyTile() const {
+    if constexpr (AutoTilingType<Tiling>) {
+      return impl::AutoTiler<Tiling>::getTile(
+          mTiling, impl::getExtents(mRange), impl::isInnerLeft<Iterate>(),
+          getPolicyExecutionSpace().concurrency());
+    } else {
+      return mTiling.getTile();
+    }
+  }
+
+private:
+  /**
+   * Tuple of the parameters, in the order of the template parameters.
+   */
+  using Parameters =
+      std::tuple<Range, Tiling, ExecutionSpace, Schedule, Iterate, League,
+                 TeamSize, VectorLength, ScratchLevel0, ScratchLevel1,
+                 TileOrder, Reducer, LaunchBounds, Occupancy, WorkTag,
+                 Vectorize>;
+
+  /**
+   * Create new execution parameters where one parameter is changed.
+   * @tparam index Position of the parameter, from `impl::ParameterIndex`.
+   * @tparam ParameterIn Class of the new parameter.
+   * @param parameter New parameter.
+   * @return New execution policy creator.
+   */
+  template <std::size_t index, typename ParameterIn>
+  auto constexpr set(ParameterIn const &parameter) const {
+    Parameters const parameters(mRange, mTiling, mExecutionSpace, mSchedule,
+                                mIterate, mLeague, mTeamSize, mVectorLength,
+                                mScratchLevel0, mScratchLevel1, mTileOrder,
+                                mReducer, mLaunchBounds, mOccupancy,
+                                mWorkTag, mVectorize);
+
+    return [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+      return ::polk::ExecutionParameters<
+          std::conditional_t<indices == index, ParameterIn,
+                             std::tuple_element_t<indices, Parameters>>...>(
+          impl::select<indices == index>(parameter,
+                                         std::get<indices>(parameters))...);
+    }(std::make_index_sequence<std::tuple_size_v<Parameters>>());
+  }
+
+  /**
+   * Check if parameters specific to team policies are specified.
+   * @return True if team size, vector length or scratch memory is set.
+   */
+  static bool constexpr hasTeamParameters() {
+    return hasTeamSize() || hasVectorLength() || hasScratch<0>() ||
+           hasScratch<1>();
+  }
+
+  /**
+   * Retrieve a Kokkos execution policy, without occupancy.
+   * @return Kokkos team policy if a league is set, Kokkos range or
+   * multidimensional range policy otherwise.
+   */
+  auto getBasePolicy() const {
+    if constexpr (hasLeague()) {
+      return getTeamPolicy();
+    } else if constexpr (getRank() > 1) {
+      using Policy = impl::PolicyWith<Kokkos::MDRangePolicy,
+                                      impl::KokkosRankType<Iterate, getRank()>,
+                                      impl::KokkosPropertyType<ExecutionSpace>,
+                                      impl::KokkosPropertyType<Schedule>,
+                                      impl::KokkosPropertyType<Range>,
+                                      impl::KokkosPropertyType<LaunchBounds>,
+                                      impl::KokkosPropertyType<WorkTag>>;
+
+      if constexpr (std::is_same_v<ExecutionSpace, UnknownExecutionSpace>) {
+        if constexpr (!hasPolicyTile()) {
+          return Policy(mRange.getBegin(), mRange.getEnd());
+        } else {
+          return Policy(mRange.getBegin(), mRange.getEnd(),
+                        getPolicyTile());
         }
       } else {
-        if constexpr (std::is_same_v<Tiling, UnknownTiling>) {
-          return Kokkos::MDRangePolicy(mExecutionSpace, mRange.getBegin(),
-                                       mRange.getEnd());
+        if constexpr (!hasPolicyTile()) {
+          return Policy(mExecutionSpace, mRange.getBegin(), mRange.getEnd());
         } else {
-          return Kokkos::MDRangePolicy(mExecutionSpace, mRange.getBegin(),
-                                       mRange.getEnd(), mTiling.getTile());
+          return Policy(mExecutionSpace, mRange.getBegin(), mRange.getEnd(),
+                        getPolicyTile());
         }
       }
     } else {
+      using Policy = impl::PolicyWith<Kokkos::RangePolicy,
+                                      impl::KokkosPropertyType<ExecutionSpace>,
+                                      impl::KokkosPropertyType<Schedule>,
+                                      impl::KokkosPropertyType<Range>,
+                                      impl::KokkosPropertyType<LaunchBounds>,
+                                      impl::KokkosPropertyType<WorkTag>>;
+
       if constexpr (std::is_same_v<ExecutionSpace, UnknownExecutionSpace>) {
-        if constexpr (std::is_same_v<Tiling, UnknownTiling>) {
-          return Kokkos::RangePolicy(mRange.getBegin()[0], mRange.getEnd()[0]);
+        if constexpr (!hasPolicyTile()) {
+          return Policy(mRange.getBegin()[0], mRange.getEnd()[0]);
         } else {
-          return Kokkos::RangePolicy(mRange.getBegin()[0], mRange.getEnd()[0],
-                                     mTiling.getTile()[0]);
+          return Policy(mRange.getBegin()[0], mRange.getEnd()[0],
+                        Kokkos::ChunkSize(getPolicyTile()[0]));
         }
       } else {
-        if constexpr (std::is_same_v<Tiling, UnknownTiling>) {
-          return Kokkos::RangePolicy(mExecutionSpace, mRange.getBegin()[0],
-                                     mRange.getEnd()[0]);
+        if constexpr (!hasPolicyTile()) {
+          return Policy(mExecutionSpace, mRange.getBegin()[0],
+                        mRange.getEnd()[0]);
         } else {
-          return Kokkos::RangePolicy(mExecutionSpace, mRange.getBegin()[0],
-                                     mRange.getEnd()[0], mTiling.getTile()[0]);
+          return Policy(mExecutionSpace, mRange.getBegin()[0],
+                        mRange.getEnd()[0],
+                        Kokkos::ChunkSize(getPolicyTile()[0]));
         }
       }
     }
   }
+
+  /**
+   * Retrieve a Kokkos team policy.
+   * The team size and the vector length are chosen by Kokkos if not set.
+   * @return Kokkos team policy.
+   */
+  auto getTeamPolicy() const {
+    using Policy = impl::PolicyWith<Kokkos::TeamPolicy,
+                                    impl::KokkosPropertyType<ExecutionSpace>,
+                                    impl::KokkosPropertyType<Schedule>,
+                                    impl::KokkosPropertyType<LaunchBounds>,
+                                    impl::KokkosPropertyType<WorkTag>>;
+
+    auto const createPolicy = [this](auto const &...arguments) {
+      if constexpr (std::is_same_v<ExecutionSpace, UnknownExecutionSpace>) {
+        return Policy(arguments...);
+      } else {
+        return Policy(mExecutionSpace, arguments...);
+      }
+    };
+    int const leagueSize = static_cast<int>(mLeague.getSize());
+    bool isTeamSizeAuto = true;
+    int teamSize = 0;
+    if constexpr (hasTeamSize()) {
+      isTeamSizeAuto = mTeamSize.isAuto();
+      teamSize = mTeamSize.getSize();
+    }
+    bool isVectorLengthAuto = false;
+    int vectorLength = 1;
+    if constexpr (hasVectorLength()) {
+      isVectorLengthAuto = mVectorLength.isAuto();
+      vectorLength = mVectorLength.getLength();
+    }
+
+    auto policy = [&]() -> Policy {
+      if (isTeamSizeAuto && isVectorLengthAuto) {
+        return createPolicy(leagueSize, Kokkos::AUTO, Kokkos::AUTO);
+      } else if (isTeamSizeAuto) {
+        return createPolicy(leagueSize, Kokkos::AUTO, vectorLength);
+      } else if (isVectorLengthAuto) {
+        return createPolicy(leagueSize, teamSize, Kokkos::AUTO);
+      } else {
+        return createPolicy(leagueSize, teamSize, vectorLength);
+      }
+    }();
+
+    if constexpr (hasScratch<0>()) {
+      policy.set_scratch_size(0, Kokkos::PerTeam(mScratchLevel0.getPerTeam()),
+                              Kokkos::PerThread(mScratchLevel0.getPerThread()));
+    }
+    if constexpr (hasScratch<1>()) {
+      policy.set_scratch_size(1, Kokkos::PerTeam(mScratchLevel1.getPerTeam()),
+                              Kokkos::PerThread(mScratchLevel1.getPerThread()));
+    }
+
+    return policy;
+  }
+
+  /**
+   * Execution space of the policy.
+   * Defaults to the Kokkos default execution space if not specified.
+   */
+  using PolicyExecutionSpace =
+      std::conditional_t<std::is_same_v<ExecutionSpace, UnknownExecutionSpace>,
+                         Kokkos::DefaultExecutionSpace, ExecutionSpace>;
+
+  /**
+   * Getter for the execution space of the policy.
+   * @return Execution space parameter, or a default instance if not
+   * specified.
+   */
+  PolicyExecutionSpace getPolicyExecutionSpace() const {
+    if constexpr (std::is_same_v<ExecutionSpace, UnknownExecutionSpace>) {
+      return PolicyExecutionSpace();
+    } else {
+      return mExecutionSpace;
+    }
+  }
 };
 
 /**
@@ -0,0 +1,109 @@
+#ifndef __POLK_FIRST_TOUCH_HPP__
+#define __POLK_FIRST_TOUCH_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+#include "work_tag.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * View touched by `FirstTouchFunctor`.
+ * @tparam index Position of the view, telling apart views of the same class.
+ * @tparam View Kokkos view class.
+ */
+template <std::size_t index, typename View> struct FirstTouchView {
+  View mView;
+};
+
+/**
+ * Kernel wrapper writing a value-initialized element in several views at the
+ * same indices.
+ * @tparam Tag Kokkos work tag given before the indices, `void` if none.
+ * @tparam Indices Index sequence of the views.
+ * @tparam Views Kokkos view classes.
+ */
+template <typename Tag, typename Indices, typename... Views>
+struct FirstTouchFunctor;
+
+template <typename Tag, std::size_t... indices, typename... Views>
+struct FirstTouchFunctor<Tag, std::index_sequence<indices...>, Views...>
+    : FirstTouchView<indices, Views>... {
+  /**
+   * Constructor.
+   * @param views Views.
+   */
+  FirstTouchFunctor(Views const &...views)
+      : FirstTouchView<indices, Views>{views}... {}
+
+  /**
+   * Touch the views.
+   * @param arguments Work tag if any, then indices.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments const &...arguments) const {
+    skipTag<Tag>(
+        [&](auto const &...points) {
+          ((FirstTouchView<indices, Views>::mView(points...) =
+                typename Views::value_type()),
+           ...);
+        },
+        arguments...);
+  }
+};
+
+} // namespace impl
+
+/**
+ * Initialize views with the mapping of a kernel.
+ * Each element of the range is written with a value-initialized element by
+ * `polk::parallel_for` on the same execution parameters as the kernel that
+ * will later use the views, so that it is touched first by the thread that
+ * computes on it. On multi-socket hosts, the pages of the views are then
+ * placed on the memory of the socket of this thread. Views should be
+ * allocated with `Kokkos::WithoutInitializing`, otherwise they are already
+ * touched by Kokkos, and the mapping only stays the same between launches
+ * with a static schedule. Elements out of the range are not touched.
+ * Tuned tiles are not supported, as the tile of the kernel is only known once
+ * it has been tuned, and the first touch would otherwise be tuned on its own;
+ * a fixed or automatic tile must be used instead.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Views Kokkos view classes, of the rank of the range.
+ * @param parameters Execution parameters of the kernel.
+ * @param views Views.
+ */
+template <ExecutionParametersType ExecutionParameters, typename... Views>
+void first_touch(ExecutionParameters const &parameters, Views const &...views) {
+  static_assert(ExecutionParameters::hasRange(), "No range set");
+  static_assert(!TunedTilingType<decltype(parameters.getTiling())>,
+                "First touch cannot be launched with a tuned tile");
+  static_assert(sizeof...(Views) > 0, "No view given");
+  static_assert((Kokkos::is_view_v<Views> && ...), "Only views can be touched");
+  static_assert(((static_cast<int>(Views::rank) ==
+                  ExecutionParameters::getRank()) &&
+                 ...),
+                "View rank and range rank missmatch");
+  static_assert(
+      (!std::is_const_v<typename Views::value_type> && ...),
+      "Views must not be constant");
+
+  using Tag = impl::KokkosPropertyType<decltype(parameters.getWorkTag())>;
+  parallel_for("polk::first_touch", parameters,
+               impl::FirstTouchFunctor<Tag, std::index_sequence_for<Views...>,
+                                       Views...>(views...));
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_FIRST_TOUCH_HPP__
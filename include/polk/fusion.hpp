@@ -0,0 +1,174 @@
+#ifndef __POLK_FUSION_HPP__
+#define __POLK_FUSION_HPP__
+
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+#include "profiling.hpp"
+#include "tile_order.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Granularity of kernel fusion.
+ */
+enum class Fusion {
+  /**
+   * All the kernels are called on an index before moving to the next one.
+   * A kernel may only depend on the results of the previous kernels at the
+   * same index.
+   */
+  perIndex,
+  /**
+   * Each kernel is called on all the indices of a tile before moving to the
+   * next kernel. A kernel may depend on the results of the previous kernels
+   * within the same tile.
+   */
+  perTile,
+};
+
+namespace impl {
+
+/**
+ * Kernel wrapper calling several kernels in order with the same arguments.
+ * @tparam Functor First kernel class.
+ * @tparam Functors Other kernel classes.
+ */
+template <typename Functor, typename... Functors> struct FusedFunctor {
+  Functor mFunctor;
+  FusedFunctor<Functors...> mFunctors;
+
+  /**
+   * Constructor.
+   * @param functor First kernel.
+   * @param functors Other kernels.
+   */
+  FusedFunctor(Functor const &functor, Functors const &...functors)
+      : mFunctor(functor), mFunctors(functors...) {}
+
+  /**
+   * Call the kernels.
+   * @param arguments Arguments of the kernels.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments const &...arguments) const {
+    mFunctor(arguments...);
+    mFunctors(arguments...);
+  }
+};
+
+template <typename Functor> struct FusedFunctor<Functor> {
+  Functor mFunctor;
+
+  /**
+   * Constructor.
+   * @param functor Kernel.
+   */
+  FusedFunctor(Functor const &functor) : mFunctor(functor) {}
+
+  /**
+   * Call the kernel.
+   * @param arguments Arguments of the kernel.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments const &...arguments) const {
+    mFunctor(arguments...);
+  }
+};
+
+/**
+ * Launch several kernels fused per tile, without profiling.
+ * The tiles are launched through a single-dimensional policy, along the
+ * space-filling curve of the tile order if set, or along a Morton curve
+ * otherwise, and each kernel iterates over the whole tile in turn. The
+ * ordering of the tiles is computed once and shared by all the kernels.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functors Kernel classes.
+ * @param label Label of the fused kernel.
+ * @param parameters Execution parameters with a tile.
+ * @param functors Kernels.
+ */
+template <typename ExecutionParameters, typename... Functors>
+void fusePerTile(std::string const &label,
+                 ExecutionParameters const &parameters,
+                 Functors const &...functors) {
+  int constexpr rank = ExecutionParameters::getRank();
+  using Curve = typename std::conditional_t<
+      ExecutionParameters::hasTileOrder(), decltype(parameters.getTileOrder()),
+      TileOrder<Morton>>::CurveType;
+  using Range = decltype(parameters.getRange());
+  using Iterate = decltype(parameters.getIterate());
+  auto const space = parameters.getPolicy().space();
+  using MemorySpace = typename decltype(space)::memory_space;
+
+  auto const range = parameters.getRange();
+  TileOrdering<Curve, rank, MemorySpace> const ordering(
+      space, getExtents(range), parameters.getPolicyTile(),
+      isInnerLeft<Iterate>());
+  auto const createTileFunctor = [&](auto const &functor) {
+    auto const taggedFunctor = getTaggedFunctor(parameters, functor);
+    return TileOrderFunctor<Curve, rank, typename Range::Index, MemorySpace,
+                            std::remove_const_t<decltype(taggedFunctor)>>(
+        taggedFunctor, range.getBegin(), range.getEnd(), ordering);
+  };
+  FusedFunctor const fusedFunctor(createTileFunctor(functors)...);
+
+  Kokkos::parallel_for(label, getTilePolicy(parameters, ordering.getLength()),
+                       fusedFunctor);
+}
+
+} // namespace impl
+
+/**
+ * Launch several kernels over the same execution parameters in a single
+ * pass.
+ * Kernels are called in the order they are given. Fusing per index is
+ * equivalent to `polk::parallel_for` with a kernel calling all the kernels,
+ * and fusing per tile requires a tile given to the policy. Strided and
+ * weighted ranges are launched through their compact range, on which the
+ * tile applies.
+ * The launch is recorded if the profiler is enabled.
+ * @tparam fusion Granularity of the fusion.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functors Kernel classes.
+ * @param label Label of the fused kernel.
+ * @param parameters Execution parameters.
+ * @param functors Kernels.
+ */
+template <Fusion fusion = Fusion::perIndex,
+          ExecutionParametersType ExecutionParameters, typename... Functors>
+void fuse(std::string const &label, ExecutionParameters const &parameters,
+          Functors const &...functors) {
+  static_assert(sizeof...(Functors) > 0, "No kernel given");
+
+  if constexpr (impl::isCompacted<ExecutionParameters>()) {
+    fuse<fusion>(label, impl::getCompactParameters(parameters),
+                 parameters.getFunctor(functors)...);
+  } else if constexpr (fusion == Fusion::perIndex) {
+    parallel_for(label, parameters, impl::FusedFunctor(functors...));
+  } else {
+    static_assert(!ExecutionParameters::hasLeague(),
+                  "Per-tile fusion cannot be launched with a league");
+    static_assert(ExecutionParameters::hasPolicyTile(),
+                  "Per-tile fusion requires a tile");
+
+    if (impl::isProfiling()) {
+      impl::profile(label, parameters, [&]() {
+        impl::fusePerTile(label, parameters, functors...);
+      });
+    } else {
+      impl::fusePerTile(label, parameters, functors...);
+    }
+  }
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_FUSION_HPP__
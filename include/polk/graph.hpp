@@ -0,0 +1,375 @@
+#ifndef __POLK_GRAPH_HPP__
+#define __POLK_GRAPH_HPP__
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Access class.
+ * Views read and written by a kernel of a launch graph. Views are identified
+ * by the memory they span, so that subviews of the same allocation which
+ * overlap are considered to alias.
+ */
+class Access {
+  /**
+   * Memory span of a view.
+   */
+  struct Span {
+    std::uintptr_t mBegin;
+    std::uintptr_t mEnd;
+
+    /**
+     * Check if two spans overlap.
+     * @param other Other span.
+     * @return True if they share at least one byte.
+     */
+    bool overlaps(Span const &other) const {
+      return mBegin < other.mEnd && other.mBegin < mEnd;
+    }
+  };
+
+  std::vector<Span> mReads;
+  std::vector<Span> mWrites;
+
+  /**
+   * Get the memory span of a view.
+   * @tparam View Kokkos view class.
+   * @param view View.
+   * @return Span.
+   */
+  template <typename View> static Span getSpan(View const &view) {
+    auto const begin = reinterpret_cast<std::uintptr_t>(view.data());
+    return {begin, begin + view.span() * sizeof(typename View::value_type)};
+  }
+
+  /**
+   * Check if two lists of spans overlap.
+   * @param first First list.
+   * @param second Second list.
+   * @return True if a span of the first list overlaps a span of the second.
+   */
+  static bool overlaps(std::vector<Span> const &first,
+                       std::vector<Span> const &second) {
+    for (auto const &span : first) {
+      for (auto const &otherSpan : second) {
+        if (span.overlaps(otherSpan)) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+public:
+  /**
+   * Add views read by the kernel.
+   * @tparam Views Kokkos view classes.
+   * @param views Views.
+   * @return New access.
+   */
+  template <typename... Views> Access reads(Views const &...views) const {
+    Access access = *this;
+    (access.mReads.push_back(getSpan(views)), ...);
+    return access;
+  }
+
+  /**
+   * Add views written by the kernel.
+   * Views that are both read and written only need to be added here.
+   * @tparam Views Kokkos view classes.
+   * @param views Views.
+   * @return New access.
+   */
+  template <typename... Views> Access writes(Views const &...views) const {
+    Access access = *this;
+    (access.mWrites.push_back(getSpan(views)), ...);
+    return access;
+  }
+
+  /**
+   * Check if a kernel must wait for a previous one.
+   * This is the case if one of them writes views that the other accesses.
+   * @param previous Access of the previous kernel.
+   * @return True if the kernel depends on the previous one.
+   */
+  bool dependsOn(Access const &previous) const {
+    return overlaps(previous.mWrites, mReads) ||
+           overlaps(previous.mWrites, mWrites) ||
+           overlaps(previous.mReads, mWrites);
+  }
+};
+
+/**
+ * Launch graph class.
+ * Records kernels with their execution parameters and the views they access,
+ * and runs them on lanes, which are partitions of an execution space.
+ * A kernel is placed on the lane of its latest dependency, or on the least
+ * loaded lane if it has none, so that independent kernels overlap. Kernels
+ * of a lane run in order, and a lane is only fenced when a kernel of another
+ * lane depends on it.
+ * @tparam ExecutionSpace Kokkos execution space class.
+ */
+template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class LaunchGraph {
+  /**
+   * Recorded kernel.
+   */
+  struct Node {
+    std::string mLabel;
+    std::function<void(ExecutionSpace const &)> mLaunch;
+    Access mAccess;
+    std::vector<std::size_t> mDependencies;
+    std::size_t mLane;
+    bool mIsWaitedAcrossLanes = false;
+  };
+
+  std::vector<ExecutionSpace> mInstances;
+  std::vector<Node> mNodes;
+
+public:
+  /**
+   * Constructor.
+   * @param laneCount Number of lanes.
+   * @param space Execution space instance partitioned into lanes.
+   */
+  explicit LaunchGraph(std::size_t const laneCount = 2,
+                       ExecutionSpace const &space = ExecutionSpace()) {
+    if (laneCount == 0) {
+      throw std::invalid_argument("Launch graph must have at least one lane");
+    }
+
+    auto const instances = Kokkos::Experimental::partition_space(
+        space, std::vector<double>(laneCount, 1.));
+    mInstances.assign(instances.begin(), instances.end());
+  }
+
+  /**
+   * Record a kernel.
+   * Nothing is launched until `run` is called.
+   * @tparam ExecutionParameters Execution parameters class.
+   * @tparam Functor Kernel class.
+   * @param label Label of the kernel.
+   * @param parameters Execution parameters, without execution space.
+   * @param functor Kernel.
+   * @param access Views accessed by the kernel.
+   * @return Index of the kernel in the graph.
+   */
+  template <ExecutionParametersType ExecutionParameters, typename Functor>
+  std::size_t add(std::string const &label,
+                  ExecutionParameters const &parameters,
+                  Functor const &functor, Access const &access) {
+    static_assert(!ExecutionParameters::hasExecutionSpace(),
+                  "Execution space already set");
+
+    Node node;
+    node.mLabel = label;
+    node.mLaunch = [label, parameters,
+                    functor](ExecutionSpace const &instance) {
+      parallel_for(label, parameters.with(instance), functor);
+    };
+    node.mAccess = access;
+
+    for (std::size_t i = 0; i < mNodes.size(); i++) {
+      if (access.dependsOn(mNodes[i].mAccess)) {
+        node.mDependencies.push_back(i);
+      }
+    }
+
+    if (node.mDependencies.empty()) {
+      std::vector<std::size_t> loads(mInstances.size(), 0);
+      for (auto const &other : mNodes) {
+        loads[other.mLane]++;
+      }
+      node.mLane = 0;
+      for (std::size_t lane = 1; lane < loads.size(); lane++) {
+        if (loads[lane] < loads[node.mLane]) {
+          node.mLane = lane;
+        }
+      }
+    } else {
+      node.mLane = mNodes[node.mDependencies.back()].mLane;
+    }
+
+    for (auto const dependency : node.mDependencies) {
+      if (mNodes[dependency].mLane != node.mLane) {
+        mNodes[dependency].mIsWaitedAcrossLanes = true;
+      }
+    }
+
+    mNodes.push_back(node);
+    return mNodes.size() - 1;
+  }
+
+  /**
+   * Run the recorded kernels.
+   * On host execution spaces whose lanes are distinct instances, each lane is
+   * run from its own thread. Otherwise (e.g. on `Kokkos::Threads`, whose
+   * lanes are copies of the same instance, or on other execution spaces),
+   * kernels are launched asynchronously in the order they were recorded. All
+   * the lanes are fenced on return, and the graph can be run again.
+   */
+  void run() const {
+    bool constexpr isHost =
+        Kokkos::SpaceAccessibility<ExecutionSpace,
+                                   Kokkos::HostSpace>::accessible;
+
+    if (isHost && impl::areDistinctInstances(mInstances)) {
+      runThreads();
+    } else {
+      runInOrder();
+    }
+  }
+
+  /**
+   * Discard the recorded kernels.
+   */
+  void clear() { mNodes.clear(); }
+
+  /**
+   * Getter for the number of recorded kernels.
+   * @return Number of kernels.
+   */
+  std::size_t getSize() const { return mNodes.size(); }
+
+  /**
+   * Getter for the number of lanes.
+   * @return Number of lanes.
+   */
+  std::size_t getLaneCount() const { return mInstances.size(); }
+
+  /**
+   * Getter for the lane of a kernel.
+   * @param node Index of the kernel.
+   * @return Lane.
+   */
+  std::size_t getLane(std::size_t const node) const {
+    return mNodes.at(node).mLane;
+  }
+
+  /**
+   * Getter for the dependencies of a kernel.
+   * @param node Index of the kernel.
+   * @return Indices of the kernels it depends on.
+   */
+  std::vector<std::size_t> const &
+  getDependencies(std::size_t const node) const {
+    return mNodes.at(node).mDependencies;
+  }
+
+  /**
+   * Getter for the execution space instances of the lanes.
+   * @return Instances.
+   */
+  std::vector<ExecutionSpace> const &getInstances() const {
+    return mInstances;
+  }
+
+private:
+  /**
+   * Run each lane from its own thread.
+   * A kernel waited by another lane is followed by a fence of its lane, after
+   * which it is marked as complete.
+   */
+  void runThreads() const {
+    std::vector<bool> isComplete(mNodes.size(), false);
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    auto const runLane = [&](std::size_t const lane) {
+      auto const &instance = mInstances[lane];
+      for (std::size_t i = 0; i < mNodes.size(); i++) {
+        auto const &node = mNodes[i];
+        if (node.mLane != lane) {
+          continue;
+        }
+
+        {
+          std::unique_lock lock(mutex);
+          condition.wait(lock, [&]() {
+            for (auto const dependency : node.mDependencies) {
+              if (mNodes[dependency].mLane != lane &&
+                  !isComplete[dependency]) {
+                return false;
+              }
+            }
+            return true;
+          });
+        }
+
+        node.mLaunch(instance);
+
+        if (node.mIsWaitedAcrossLanes) {
+          instance.fence("polk: launch graph dependency " + node.mLabel);
+          {
+            std::lock_guard lock(mutex);
+            isComplete[i] = true;
+          }
+          condition.notify_all();
+        }
+      }
+      instance.fence("polk: launch graph end");
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t lane = 1; lane < mInstances.size(); lane++) {
+      threads.emplace_back(runLane, lane);
+    }
+    runLane(0);
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  /**
+   * Launch the kernels in order.
+   * Before a kernel, the lanes of its dependencies in other lanes are fenced,
+   * unless they have been fenced since these dependencies were launched.
+   */
+  void runInOrder() const {
+    std::vector<std::size_t> launchCounts(mInstances.size(), 0);
+    std::vector<std::size_t> fenceCounts(mInstances.size(), 0);
+    std::vector<std::size_t> positions(mNodes.size(), 0);
+
+    for (std::size_t i = 0; i < mNodes.size(); i++) {
+      auto const &node = mNodes[i];
+      for (auto const dependency : node.mDependencies) {
+        auto const lane = mNodes[dependency].mLane;
+        if (lane != node.mLane && fenceCounts[lane] <= positions[dependency]) {
+          mInstances[lane].fence("polk: launch graph dependency " +
+                                 mNodes[dependency].mLabel);
+          fenceCounts[lane] = launchCounts[lane];
+        }
+      }
+
+      node.mLaunch(mInstances[node.mLane]);
+      positions[i] = launchCounts[node.mLane]++;
+    }
+
+    for (auto const &instance : mInstances) {
+      instance.fence("polk: launch graph end");
+    }
+  }
+};
+
+} // namespace polk
+
+#endif // ifndef __POLK_GRAPH_HPP__
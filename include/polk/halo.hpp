@@ -0,0 +1,120 @@
+#ifndef __POLK_HALO_HPP__
+#define __POLK_HALO_HPP__
+
+#include <cstddef>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Halo decomposition class.
+ * Execution parameters of the interior of a range, which does not depend on
+ * the halo, and of its boundary, split into one slab per side of each
+ * dimension.
+ * @tparam ExecutionParameters Execution parameters class.
+ */
+template <ExecutionParametersType ExecutionParameters> class HaloDecomposition {
+  ExecutionParameters mInterior;
+  std::vector<ExecutionParameters> mBoundaries;
+
+public:
+  /**
+   * Constructor.
+   * @param interior Execution parameters of the interior.
+   * @param boundaries Execution parameters of the boundary slabs.
+   */
+  HaloDecomposition(ExecutionParameters const &interior,
+                    std::vector<ExecutionParameters> const &boundaries)
+      : mInterior(interior), mBoundaries(boundaries) {}
+
+  /**
+   * Getter for the interior.
+   * @return Execution parameters of the interior.
+   */
+  ExecutionParameters const &getInterior() const { return mInterior; }
+
+  /**
+   * Getter for the boundary slabs.
+   * @return Execution parameters of the slabs, the lower one then the upper
+   * one for each dimension in order. Some of them may have an empty range.
+   */
+  std::vector<ExecutionParameters> const &getBoundaries() const {
+    return mBoundaries;
+  }
+};
+
+/**
+ * Decompose the range of execution parameters into an interior and a
+ * boundary.
+ * The boundary has the given width on each side of each dimension, and the
+ * slabs do not overlap: the slabs of a dimension span the interior of the
+ * previous dimensions and the whole extent of the next ones. All the other
+ * parameters are kept, so that each part may be launched on its own
+ * execution space instance with `replace`.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @param parameters Execution parameters with a range.
+ * @param widths Width of the boundary in each dimension, clamped so that the
+ * slabs do not overlap.
+ * @return Decomposition.
+ */
+template <ExecutionParametersType ExecutionParameters>
+auto decomposeHalo(
+    ExecutionParameters const &parameters,
+    Kokkos::Array<std::size_t, ExecutionParameters::getRank()> const &widths) {
+  static_assert(ExecutionParameters::hasRange(), "No range set");
+  static_assert(!impl::isCompacted<ExecutionParameters>(),
+                "Halo decomposition cannot be used with a strided or "
+                "weighted range");
+
+  int constexpr rank = ExecutionParameters::getRank();
+  using Range = decltype(parameters.getRange());
+  using Index = typename Range::Index;
+
+  auto const range = parameters.getRange();
+  auto const begin = range.getBegin();
+  auto end = range.getEnd();
+  Kokkos::Array<Index, rank> interiorBegin;
+  Kokkos::Array<Index, rank> interiorEnd;
+  for (int d = 0; d < rank; d++) {
+    Index const extent = end[d] > begin[d] ? end[d] - begin[d] : 0;
+    Index const width = static_cast<Index>(widths[d]) < extent / 2
+                            ? static_cast<Index>(widths[d])
+                            : extent / 2;
+    end[d] = begin[d] + extent;
+    interiorBegin[d] = begin[d] + width;
+    interiorEnd[d] = end[d] - width;
+  }
+
+  std::vector<ExecutionParameters> boundaries;
+  for (int d = 0; d < rank; d++) {
+    auto lower = begin;
+    auto upper = end;
+    for (int e = 0; e < d; e++) {
+      lower[e] = interiorBegin[e];
+      upper[e] = interiorEnd[e];
+    }
+
+    auto lowerSlabEnd = upper;
+    lowerSlabEnd[d] = interiorBegin[d];
+    boundaries.push_back(parameters.replace(Range(lower, lowerSlabEnd)));
+
+    auto upperSlabBegin = lower;
+    upperSlabBegin[d] = interiorEnd[d];
+    boundaries.push_back(parameters.replace(Range(upperSlabBegin, upper)));
+  }
+
+  return HaloDecomposition<ExecutionParameters>(
+      parameters.replace(Range(interiorBegin, interiorEnd)), boundaries);
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_HALO_HPP__
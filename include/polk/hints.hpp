@@ -0,0 +1,97 @@
+#ifndef __POLK_HINTS_HPP__
+#define __POLK_HINTS_HPP__
+
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Launch bounds class.
+ * Hint forwarded to the policy as `Kokkos::LaunchBounds`, used by device
+ * backends to limit the register usage of the kernel. It is ignored by host
+ * backends.
+ * @tparam maxThreadsPerBlock Maximum number of threads per block, 0 if not
+ * constrained.
+ * @tparam minBlocksPerMultiprocessor Minimum number of blocks per
+ * multiprocessor, 0 if not constrained.
+ */
+template <unsigned int maxThreadsPerBlock = 0,
+          unsigned int minBlocksPerMultiprocessor = 0>
+struct LaunchBounds {
+  /**
+   * Marker to identify the class as launch bounds.
+   */
+  using LaunchBoundsType =
+      LaunchBounds<maxThreadsPerBlock, minBlocksPerMultiprocessor>;
+
+  /**
+   * Corresponding Kokkos launch bounds property.
+   */
+  using KokkosLaunchBounds =
+      Kokkos::LaunchBounds<maxThreadsPerBlock, minBlocksPerMultiprocessor>;
+};
+
+/**
+ * Concept for the launch bounds.
+ */
+template <typename T>
+concept LaunchBoundsType = std::same_as<T, typename T::LaunchBoundsType>;
+
+/**
+ * Default launch bounds.
+ */
+struct UnknownLaunchBounds {};
+
+/**
+ * Occupancy class.
+ * Hint forwarded to the policy with `Kokkos::Experimental::prefer` and
+ * `Kokkos::Experimental::DesiredOccupancy`, used by device backends to limit
+ * the number of concurrent blocks. It is ignored by host backends.
+ */
+class Occupancy {
+  int mPercent;
+
+public:
+  /**
+   * Marker to identify the class as an occupancy.
+   */
+  using OccupancyType = Occupancy;
+
+  Occupancy() = delete;
+
+  /**
+   * Constructor.
+   * @param percent Desired occupancy, in percent.
+   */
+  explicit Occupancy(int const percent) : mPercent(percent) {
+    if (percent < 1 || percent > 100) {
+      throw std::invalid_argument("Occupancy must be between 1 and 100");
+    }
+  }
+
+  /**
+   * Getter for the desired occupancy.
+   * @return Occupancy, in percent.
+   */
+  int getPercent() const { return mPercent; }
+};
+
+/**
+ * Concept for the occupancy.
+ */
+template <typename T>
+concept OccupancyType = std::same_as<T, typename T::OccupancyType>;
+
+/**
+ * Default occupancy.
+ */
+struct UnknownOccupancy {};
+
+} // namespace polk
+
+#endif // ifndef __POLK_HINTS_HPP__
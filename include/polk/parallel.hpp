@@ -0,0 +1,599 @@
+#ifndef __POLK_PARALLEL_HPP__
+#define __POLK_PARALLEL_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "auto_tiling.hpp"
+#include "execution_policy_creator.hpp"
+#include "profiling.hpp"
+#include "reducer.hpp"
+#include "tile_order.hpp"
+#include "tuning.hpp"
+#include "vectorize.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * Launch a parallel for with a tuned tile.
+ * If the kernel has already been tuned, its best tile is used. Otherwise,
+ * the launch is a trial of its tuning session and is timed, the execution
+ * space instance being fenced before and after.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel, part of the tuning key.
+ * @param parameters Execution parameters with a tuned tile.
+ * @param functor Kernel.
+ * @param launchedTile If not null, set to the tile that is launched.
+ */
+template <typename ExecutionParameters, typename Functor>
+void parallelForTuned(std::string const &label,
+                      ExecutionParameters const &parameters,
+                      Functor const &functor,
+                      std::vector<std::size_t> *const launchedTile = nullptr) {
+  int constexpr rank = ExecutionParameters::getRank();
+  using Iterate = decltype(parameters.getIterate());
+
+  auto const launch = [&](std::vector<std::size_t> const &tile) {
+    if (launchedTile != nullptr) {
+      *launchedTile = tile;
+    }
+    Kokkos::Array<std::size_t, rank> tileArray;
+    std::copy(tile.begin(), tile.end(), tileArray.data());
+    Kokkos::parallel_for(
+        label, parameters.replace(Tiling<rank>(tileArray)).getPolicy(),
+        functor);
+  };
+
+  auto const space = parameters.getPolicy().space();
+  using Space = std::remove_cv_t<std::remove_reference_t<decltype(space)>>;
+  bool constexpr isHost =
+      Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible;
+  auto const extents = getExtents(parameters.getRange());
+  auto const key = getTuningKey(label, Space::name(), extents);
+  auto &cache = TuningCache::getInstance();
+
+  if (auto const tile = cache.find(key, rank)) {
+    launch(*tile);
+    return;
+  }
+
+  auto candidates =
+      getTuningCandidates(extents, isInnerLeft<Iterate>(), isHost);
+  if constexpr (isHost) {
+    auto const autoTile = computeAutoTile(
+        extents, parameters.getTiling().getBytesPerIteration(),
+        isInnerLeft<Iterate>(), space.concurrency(), getHostCacheSizes());
+    std::vector<std::size_t> const autoTileVector(
+        autoTile.data(), autoTile.data() + autoTile.size());
+    if (std::find(candidates.begin(), candidates.end(), autoTileVector) ==
+        candidates.end()) {
+      candidates.insert(candidates.begin(), autoTileVector);
+    }
+  }
+
+  auto const trial = cache.startTrial(key, candidates);
+  space.fence("polk: before tuning trial");
+  Kokkos::Timer timer;
+  launch(trial.mTile);
+  space.fence("polk: after tuning trial");
+  cache.endTrial(key, trial, timer.seconds());
+}
+
+/**
+ * Wrap a kernel launched through a policy without the work tag of the
+ * parameters.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ * @return Kernel called with the work tag if it is set, the kernel itself
+ * otherwise.
+ */
+template <typename ExecutionParameters, typename Functor>
+auto getTaggedFunctor([[maybe_unused]] ExecutionParameters const &parameters,
+                      Functor const &functor) {
+  if constexpr (ExecutionParameters::hasWorkTag()) {
+    using Tag = KokkosPropertyType<decltype(parameters.getWorkTag())>;
+    return TaggedFunctor<Tag, Functor>{functor};
+  } else {
+    return functor;
+  }
+}
+
+/**
+ * Retrieve a single-dimensional Kokkos policy launching one index per tile.
+ * The execution space, the schedule, the index type of the range, the launch
+ * bounds and the occupancy of the parameters are forwarded, but not the work
+ * tag, which the kernel must give itself with `getTaggedFunctor`.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @param parameters Execution parameters.
+ * @param length Number of indices.
+ * @return Kokkos range policy.
+ */
+template <typename ExecutionParameters>
+auto getTilePolicy(ExecutionParameters const &parameters,
+                   std::size_t const length) {
+  using Policy = PolicyWith<
+      Kokkos::RangePolicy,
+      KokkosPropertyType<decltype(parameters.getExecutionSpace())>,
+      KokkosPropertyType<decltype(parameters.getSchedule())>,
+      KokkosPropertyType<decltype(parameters.getRange())>,
+      KokkosPropertyType<decltype(parameters.getLaunchBounds())>>;
+
+  Policy const policy(parameters.getPolicy().space(), 0, length);
+  if constexpr (ExecutionParameters::hasOccupancy()) {
+    return Kokkos::Experimental::prefer(
+        policy, Kokkos::Experimental::DesiredOccupancy(
+                    parameters.getOccupancy().getPercent()));
+  } else {
+    return policy;
+  }
+}
+
+/**
+ * Launch a parallel for with a tile order.
+ * The tiles of the range are numbered along the space-filling curve of the
+ * tile order, and launched through a single-dimensional policy, each index
+ * iterating over the points of its tile. The numbering is computed once per
+ * tile counts and reused by later launches.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters with a tile order and a tile.
+ * @param functor Kernel.
+ */
+template <typename ExecutionParameters, typename Functor>
+void parallelForTileOrder(std::string const &label,
+                          ExecutionParameters const &parameters,
+                          Functor const &functor) {
+  int constexpr rank = ExecutionParameters::getRank();
+  static_assert(rank > 1, "Tile order requires a multidimensional range");
+
+  using Curve = typename decltype(parameters.getTileOrder())::CurveType;
+  using Range = decltype(parameters.getRange());
+  using Iterate = decltype(parameters.getIterate());
+
+  auto const range = parameters.getRange();
+  auto const taggedFunctor = getTaggedFunctor(parameters, functor);
+  auto const space = parameters.getPolicy().space();
+  using MemorySpace = typename decltype(space)::memory_space;
+  TileOrdering<Curve, rank, MemorySpace> const ordering(
+      space, getExtents(range), parameters.getPolicyTile(),
+      isInnerLeft<Iterate>());
+  TileOrderFunctor<Curve, rank, typename Range::Index, MemorySpace,
+                   std::remove_const_t<decltype(taggedFunctor)>> const
+      tileOrderFunctor(taggedFunctor, range.getBegin(), range.getEnd(),
+                       ordering);
+
+  Kokkos::parallel_for(
+      label, getTilePolicy(parameters, tileOrderFunctor.getLength()),
+      tileOrderFunctor);
+}
+
+/**
+ * Check if a parallel for is vectorized.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @return True if vectorization is set for a multidimensional range on an
+ * execution space that can access the host memory.
+ */
+template <typename ExecutionParameters> bool constexpr isVectorized() {
+  if constexpr (ExecutionParameters::hasVectorize() &&
+                ExecutionParameters::getRank() > 1) {
+    using Space = typename decltype(std::declval<ExecutionParameters const &>()
+                                        .getPolicy())::execution_space;
+    return Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * Launch a parallel for from execution parameters, without profiling nor
+ * vectorization.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ * @param launchedTile If not null, set to the tile that is launched, empty
+ * if none is given to the policy.
+ */
+template <typename ExecutionParameters, typename Functor>
+void parallelForScalar(std::string const &label,
+                       ExecutionParameters const &parameters,
+                       Functor const &functor,
+                       std::vector<std::size_t> *const launchedTile = nullptr) {
+  if constexpr (TunedTilingType<decltype(parameters.getTiling())>) {
+    parallelForTuned(label, parameters, functor, launchedTile);
+    return;
+  } else if constexpr (ExecutionParameters::hasTileOrder() &&
+                       ExecutionParameters::hasPolicyTile()) {
+    parallelForTileOrder(label, parameters, functor);
+  } else {
+    Kokkos::parallel_for(label, parameters.getPolicy(), functor);
+  }
+
+  if (launchedTile != nullptr) {
+    launchedTile->clear();
+    if constexpr (ExecutionParameters::hasPolicyTile()) {
+      auto const tile = parameters.getPolicyTile();
+      launchedTile->assign(tile.data(), tile.data() + tile.size());
+    }
+  }
+}
+
+/**
+ * Launch a vectorized parallel for.
+ * The innermost dimension of the range, and of the tile if any, is reduced to
+ * its first index, and the kernel is wrapped to iterate over this dimension.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters with vectorization.
+ * @param functor Kernel.
+ * @param launchedTile If not null, set to the tile that is launched, whose
+ * innermost extent is 1.
+ */
+template <typename ExecutionParameters, typename Functor>
+void parallelForVectorized(
+    std::string const &label, ExecutionParameters const &parameters,
+    Functor const &functor,
+    std::vector<std::size_t> *const launchedTile = nullptr) {
+  int constexpr rank = ExecutionParameters::getRank();
+  using Range = decltype(parameters.getRange());
+  using Index = typename Range::Index;
+  using Iterate = decltype(parameters.getIterate());
+  int constexpr inner = isInnerLeft<Iterate>() ? 0 : rank - 1;
+
+  auto const range = parameters.getRange();
+  auto lineEnd = range.getEnd();
+  lineEnd[inner] = range.getBegin()[inner] < range.getEnd()[inner]
+                       ? range.getBegin()[inner] + 1
+                       : range.getEnd()[inner];
+  VectorizedFunctor<rank, Index, Functor, inner,
+                    KokkosPropertyType<decltype(parameters.getWorkTag())>> const
+      vectorizedFunctor{functor, range.getBegin()[inner],
+                        range.getEnd()[inner]};
+  auto const lineParameters =
+      parameters.replace(Range(range.getBegin(), lineEnd));
+
+  if constexpr (TilingType<decltype(parameters.getTiling())>) {
+    auto tile = parameters.getTiling().getTile();
+    tile[inner] = 1;
+    parallelForScalar(label, lineParameters.replace(Tiling<rank>(tile)),
+                      vectorizedFunctor, launchedTile);
+  } else {
+    parallelForScalar(label, lineParameters, vectorizedFunctor, launchedTile);
+  }
+}
+
+/**
+ * Launch a parallel for from execution parameters, without profiling.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ * @param launchedTile If not null, set to the tile that is launched, empty
+ * if none is given to the policy.
+ */
+template <typename ExecutionParameters, typename Functor>
+void parallelFor(std::string const &label,
+                 ExecutionParameters const &parameters, Functor const &functor,
+                 std::vector<std::size_t> *const launchedTile = nullptr) {
+  if constexpr (isVectorized<ExecutionParameters>()) {
+    parallelForVectorized(label, parameters, functor, launchedTile);
+  } else {
+    parallelForScalar(label, parameters, functor, launchedTile);
+  }
+}
+
+/**
+ * Retrieve the Kokkos execution policy of a reduction or a scan.
+ * Single-dimensional ranges without tile on execution spaces that can access
+ * the host memory receive a reduction chunk size. Other policies are the ones
+ * of the parameters.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @param parameters Execution parameters.
+ * @return Kokkos execution policy.
+ */
+template <typename ExecutionParameters>
+auto getReducePolicy(ExecutionParameters const &parameters) {
+  if constexpr (!ExecutionParameters::hasLeague() &&
+                ExecutionParameters::getRank() == 1 &&
+                !ExecutionParameters::hasTiling()) {
+    using Space = typename decltype(parameters.getPolicy())::execution_space;
+    if constexpr (Kokkos::SpaceAccessibility<Space,
+                                             Kokkos::HostSpace>::accessible) {
+      auto const chunk =
+          getReductionChunk(getExtents(parameters.getRange())[0],
+                            parameters.getPolicy().space().concurrency());
+      return parameters.with(Tiling<1>(chunk)).getPolicy();
+    } else {
+      return parameters.getPolicy();
+    }
+  } else {
+    return parameters.getPolicy();
+  }
+}
+
+/**
+ * Launch a parallel reduce from execution parameters, without profiling.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @tparam Results Result classes.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ * @param results Results.
+ */
+template <typename ExecutionParameters, typename Functor, typename... Results>
+void parallelReduce(std::string const &label,
+                    ExecutionParameters const &parameters,
+                    Functor const &functor, Results &&...results) {
+  auto const policy = getReducePolicy(parameters);
+  if constexpr (ExecutionParameters::hasReducer()) {
+    using Reducer = decltype(parameters.getReducer());
+    static_assert(Reducer::getSize() == sizeof...(Results),
+                  "Reducer count and result count missmatch");
+
+    auto reducers = Reducer::createKokkosReducers(results...);
+    std::apply(
+        [&](auto &...kokkosReducers) {
+          Kokkos::parallel_reduce(label, policy, functor, kokkosReducers...);
+        },
+        reducers);
+  } else {
+    Kokkos::parallel_reduce(label, policy, functor,
+                            std::forward<Results>(results)...);
+  }
+}
+
+/**
+ * Check if the range of execution parameters is launched through a compact
+ * range.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @return True if the range is a strided or weighted range.
+ */
+template <typename ExecutionParameters> bool constexpr isCompacted() {
+  return CompactedRangeType<
+      decltype(std::declval<ExecutionParameters>().getRange())>;
+}
+
+/**
+ * Replace the strided or weighted range of execution parameters by its
+ * compact range.
+ * The kernel must then be wrapped with the `getFunctor` method of the
+ * original parameters.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @param parameters Execution parameters with a strided or weighted range.
+ * @return New execution parameters.
+ */
+template <typename ExecutionParameters>
+auto getCompactParameters(ExecutionParameters const &parameters) {
+  return parameters.replace(parameters.getRange().getCompactRange());
+}
+
+/**
+ * Deduce the partial value type from the call operator of a scan kernel.
+ * @param callOperator Call operator, taking the partial value before the
+ * final pass flag.
+ * @return Partial value type (unevaluated).
+ */
+template <typename Class, typename Result, typename... Arguments>
+auto deduceScanValue(Result (Class::*callOperator)(Arguments...) const)
+    -> std::remove_cvref_t<std::tuple_element_t<sizeof...(Arguments) - 2,
+                                                std::tuple<Arguments...>>>;
+
+/**
+ * Get the value type of a scan.
+ * It is the `value_type` of the kernel if it declares one, the type of the
+ * total if one is given, or the type of the partial value taken by the call
+ * operator of the kernel otherwise.
+ * @tparam Functor Kernel class.
+ * @tparam Total Class of the total, if any.
+ * @return Value type, wrapped in `std::type_identity`.
+ */
+template <typename Functor, typename... Total> auto getScanValueType() {
+  if constexpr (requires { typename Functor::value_type; }) {
+    return std::type_identity<typename Functor::value_type>();
+  } else if constexpr (sizeof...(Total) == 1) {
+    return std::type_identity<std::remove_cv_t<Total>...>();
+  } else {
+    static_assert(requires { &Functor::operator(); },
+                  "Scan value type cannot be deduced from a kernel with a "
+                  "template call operator, give a total or a value_type");
+    using Value = decltype(deduceScanValue(&Functor::operator()));
+    return std::type_identity<Value>();
+  }
+}
+
+/**
+ * Kernel wrapper declaring the value type of a scan.
+ * Used for kernels wrapped by a strided or weighted range, whose template
+ * call operator prevents Kokkos from deducing the value type.
+ * @tparam Value Value type of the scan.
+ * @tparam Functor Kernel class.
+ */
+template <typename Value, typename Functor> struct ScanFunctor {
+  /**
+   * Value type of the scan.
+   */
+  using value_type = Value;
+
+  Functor mFunctor;
+
+  /**
+   * Call the kernel.
+   * @param arguments Arguments of the kernel.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments &&...arguments) const {
+    mFunctor(static_cast<Arguments &&>(arguments)...);
+  }
+};
+
+/**
+ * Check if execution space instances are distinct, so that kernels can be
+ * launched on them concurrently from several threads.
+ * Backends without support for instances, such as `Kokkos::Threads`, return
+ * copies of the same instance from `Kokkos::Experimental::partition_space`,
+ * on which concurrent launches are not allowed.
+ * @tparam Instances Container class of execution space instances.
+ * @param instances Execution space instances.
+ * @return True if no two instances are the same.
+ */
+template <typename Instances>
+bool areDistinctInstances(Instances const &instances) {
+  for (std::size_t i = 0; i < instances.size(); i++) {
+    for (std::size_t j = i + 1; j < instances.size(); j++) {
+      if (instances[i].impl_instance_id() ==
+          instances[j].impl_instance_id()) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace impl
+
+/**
+ * Launch a parallel for from execution parameters.
+ * Equivalent to `Kokkos::parallel_for` with the policy of the parameters,
+ * except for tuned tiles, which are tuned on the first launches of the
+ * kernel, for tile orders, which are used if a tile is given to the
+ * policy, and for vectorization, which iterates over the innermost dimension
+ * in the kernel on execution spaces that can access the host memory. Strided
+ * and weighted ranges are launched through their compact range. The launch is
+ * recorded if the profiler is enabled.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ */
+template <ExecutionParametersType ExecutionParameters, typename Functor>
+void parallel_for(std::string const &label,
+                  ExecutionParameters const &parameters,
+                  Functor const &functor) {
+  if constexpr (impl::isCompacted<ExecutionParameters>()) {
+    parallel_for(label, impl::getCompactParameters(parameters),
+                 parameters.getFunctor(functor));
+  } else if (impl::isProfiling()) {
+    impl::profile(label, parameters,
+                  [&](std::vector<std::size_t> *const launchedTile) {
+                    impl::parallelFor(label, parameters, functor,
+                                      launchedTile);
+                  });
+  } else {
+    impl::parallelFor(label, parameters, functor);
+  }
+}
+
+/**
+ * Launch a parallel reduce from execution parameters.
+ * Equivalent to `Kokkos::parallel_reduce` with the policy of the parameters,
+ * except that single-dimensional ranges without tile use a reduction chunk
+ * size on execution spaces that can access the host memory.
+ * If a reducer is set, one result is given per reducer, and the kernel
+ * receives one accumulator per reducer, all of them being reduced in a single
+ * pass. Otherwise, the results are given as is to Kokkos, and may be values
+ * (summed) or Kokkos reducers.
+ * Tuned tiles and tile orders are not used. Strided and weighted ranges are
+ * launched through their compact range. The launch is recorded if the
+ * profiler is enabled.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @tparam Results Result classes.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param functor Kernel.
+ * @param results Results.
+ */
+template <ExecutionParametersType ExecutionParameters, typename Functor,
+          typename... Results>
+void parallel_reduce(std::string const &label,
+                     ExecutionParameters const &parameters,
+                     Functor const &functor, Results &&...results) {
+  static_assert(sizeof...(Results) > 0, "No result given");
+
+  if constexpr (impl::isCompacted<ExecutionParameters>()) {
+    parallel_reduce(label, impl::getCompactParameters(parameters),
+                    parameters.getFunctor(functor),
+                    std::forward<Results>(results)...);
+  } else if (impl::isProfiling()) {
+    impl::profile(label, parameters, [&]() {
+      impl::parallelReduce(label, parameters, functor,
+                           std::forward<Results>(results)...);
+    });
+  } else {
+    impl::parallelReduce(label, parameters, functor,
+                         std::forward<Results>(results)...);
+  }
+}
+
+/**
+ * Launch a parallel scan from execution parameters.
+ * Equivalent to `Kokkos::parallel_scan` with the policy of the parameters,
+ * which uses a reduction chunk size if no tile is set, on execution spaces
+ * that can access the host memory. Strided and weighted ranges are launched
+ * through their compact range. The launch is recorded if the profiler is
+ * enabled.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Functor Kernel class.
+ * @tparam Total Class of the total, if any.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters, with a single-dimensional range.
+ * @param functor Kernel.
+ * @param total Optional total of the scan.
+ */
+template <ExecutionParametersType ExecutionParameters, typename Functor,
+          typename... Total>
+void parallel_scan(std::string const &label,
+                   ExecutionParameters const &parameters,
+                   Functor const &functor, Total &...total) {
+  static_assert(sizeof...(Total) <= 1, "Only one total can be given");
+  static_assert(!ExecutionParameters::hasLeague(),
+                "Scan cannot be launched with a league");
+  static_assert(ExecutionParameters::getRank() == 1,
+                "Scan requires a single-dimensional range");
+  static_assert(!ExecutionParameters::hasReducer(),
+                "Scan cannot be launched with a reducer");
+
+  auto const launch = [&]() {
+    Kokkos::parallel_scan(label, impl::getReducePolicy(parameters), functor,
+                          total...);
+  };
+  if constexpr (impl::isCompacted<ExecutionParameters>()) {
+    using Value = typename decltype(impl::getScanValueType<Functor,
+                                                           Total...>())::type;
+    auto const compactFunctor = parameters.getFunctor(functor);
+    using CompactFunctor = std::remove_const_t<decltype(compactFunctor)>;
+    parallel_scan(label, impl::getCompactParameters(parameters),
+                  impl::ScanFunctor<Value, CompactFunctor>{compactFunctor},
+                  total...);
+  } else if (impl::isProfiling()) {
+    impl::profile(label, parameters, launch);
+  } else {
+    launch();
+  }
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_PARALLEL_HPP__
@@ -0,0 +1,253 @@
+#ifndef __POLK_PARTITION_HPP__
+#define __POLK_PARTITION_HPP__
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Partition class.
+ * Split of a range along one axis into weighted sub-ranges, each of them
+ * being launched on its own partition of the execution space.
+ * @tparam axis Dimension of the range that is split.
+ */
+template <int axis = 0> struct Partition {
+  static_assert(axis >= 0, "Partition axis must be positive");
+
+  static int constexpr mAxis = axis;
+  std::vector<double> mWeights;
+
+public:
+  /**
+   * Marker to identify the class as a partition.
+   */
+  using PartitionType = Partition<axis>;
+
+  Partition() = delete;
+
+  /**
+   * Constructor.
+   * @param weights Relative weights of the sub-ranges, one per partition of
+   * the execution space.
+   * @throw std::invalid_argument If there is no weight, if a weight is
+   * negative, or if they are all null.
+   */
+  Partition(std::vector<double> const &weights) : mWeights(weights) {
+    double total = 0;
+    for (auto const weight : mWeights) {
+      if (weight < 0) {
+        throw std::invalid_argument("Partition weights must be positive");
+      }
+      total += weight;
+    }
+
+    if (total <= 0) {
+      throw std::invalid_argument("Partition weights must not all be null");
+    }
+  }
+
+  /**
+   * Getter for the weights.
+   * @return Weights of the sub-ranges.
+   */
+  std::vector<double> const &getWeights() const { return mWeights; }
+
+  /**
+   * Getter for the number of sub-ranges.
+   * @return Number of sub-ranges.
+   */
+  std::size_t getSize() const { return mWeights.size(); }
+
+  /**
+   * Getter for the axis.
+   * @return Dimension of the range that is split.
+   */
+  static int constexpr getAxis() { return mAxis; }
+};
+
+/**
+ * Concept for the partition.
+ */
+template <typename T>
+concept PartitionType = std::same_as<T, typename T::PartitionType>;
+
+/**
+ * Create an even partition.
+ * @tparam axis Dimension of the range that is split.
+ * @param size Number of sub-ranges.
+ * @return Partition with equal weights.
+ */
+template <int axis = 0> Partition<axis> evenPartition(std::size_t const size) {
+  return Partition<axis>(std::vector<double>(size, 1.));
+}
+
+namespace impl {
+
+/**
+ * Split a range along an axis.
+ * Sub-ranges are contiguous and proportional to their weights, the last one
+ * ending at the end of the range. Some of them may be empty.
+ * @tparam axis Dimension of the range that is split.
+ * @tparam Range Range class.
+ * @param range Range.
+ * @param weights Relative weights of the sub-ranges.
+ * @return Sub-ranges.
+ */
+template <int axis, RangeType Range>
+std::vector<Range> splitRange(Range const &range,
+                              std::vector<double> const &weights) {
+  static_assert(axis < Range::getRank(), "Partition axis out of range");
+
+  using Index = typename Range::Index;
+  auto const begin = range.getBegin();
+  auto const end = range.getEnd();
+  Index const extent = end[axis] > begin[axis] ? end[axis] - begin[axis] : 0;
+  double total = 0;
+  for (auto const weight : weights) {
+    total += weight;
+  }
+
+  std::vector<Range> ranges;
+  double cumulative = 0;
+  Index lower = begin[axis];
+  for (std::size_t i = 0; i < weights.size(); i++) {
+    cumulative += weights[i];
+    Index const upper =
+        begin[axis] +
+        (i + 1 == weights.size()
+             ? extent
+             : static_cast<Index>(std::llround(
+                   static_cast<double>(extent) * cumulative / total)));
+    auto subBegin = begin;
+    auto subEnd = end;
+    subBegin[axis] = lower;
+    subEnd[axis] = upper;
+    ranges.emplace_back(subBegin, subEnd);
+    lower = upper;
+  }
+
+  return ranges;
+}
+
+} // namespace impl
+
+/**
+ * Launch a parallel for split over partitions of the execution space.
+ * The execution space of the parameters (or the default one) is partitioned
+ * with `Kokkos::Experimental::partition_space`, and each sub-range is
+ * launched with `polk::parallel_for` on its own partition. On host execution
+ * spaces, the launches are made concurrently from separate threads if the
+ * partitions are distinct instances, and in turn from the calling thread
+ * otherwise (e.g. on `Kokkos::Threads`); each partition is fenced, so that
+ * they are complete on return, and an exception thrown by a launch is
+ * rethrown once all of them are over. On other execution spaces, the
+ * launches are asynchronous and the returned partitions must be fenced before
+ * using the results. Strided and weighted ranges are split along their
+ * compact range.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Partition Partition class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param partition Partition.
+ * @param functor Kernel.
+ * @return Partitions of the execution space, one per sub-range.
+ */
+template <ExecutionParametersType ExecutionParameters,
+          PartitionType Partition, typename Functor>
+auto parallel_for_partitioned(std::string const &label,
+                              ExecutionParameters const &parameters,
+                              Partition const &partition,
+                              Functor const &functor) {
+  static_assert(ExecutionParameters::hasRange(), "No range set");
+  static_assert(Partition::getAxis() < ExecutionParameters::getRank(),
+                "Partition axis out of range");
+
+  if constexpr (impl::isCompacted<ExecutionParameters>()) {
+    return parallel_for_partitioned(label,
+                                    impl::getCompactParameters(parameters),
+                                    partition, parameters.getFunctor(functor));
+  } else {
+    auto const space = [&parameters]() {
+      if constexpr (ExecutionParameters::hasExecutionSpace()) {
+        return parameters.getExecutionSpace();
+      } else {
+        return Kokkos::DefaultExecutionSpace();
+      }
+    }();
+    using Space = std::remove_cv_t<decltype(space)>;
+    bool constexpr isHost =
+        Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible;
+
+    auto const instances = Kokkos::Experimental::partition_space(
+        space, partition.getWeights());
+    auto const ranges = impl::splitRange<Partition::getAxis()>(
+        parameters.getRange(), partition.getWeights());
+
+    auto const launch = [&](std::size_t const i) {
+      int constexpr axis = Partition::getAxis();
+      if (ranges[i].getEnd()[axis] <= ranges[i].getBegin()[axis]) {
+        return;
+      }
+
+      parallel_for(label, parameters.replace(ranges[i]).replace(instances[i]),
+                   functor);
+      if constexpr (isHost) {
+        instances[i].fence(
+            "polk::parallel_for_partitioned: wait for partition");
+      }
+    };
+
+    if (isHost && impl::areDistinctInstances(instances)) {
+      // exceptions are caught in each thread and rethrown once all threads
+      // are joined
+      std::vector<std::exception_ptr> exceptions(ranges.size());
+      auto const launchCatching = [&](std::size_t const i) {
+        try {
+          launch(i);
+        } catch (...) {
+          exceptions[i] = std::current_exception();
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (std::size_t i = 1; i < ranges.size(); i++) {
+        threads.emplace_back(launchCatching, i);
+      }
+      launchCatching(0);
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      for (auto const &exception : exceptions) {
+        if (exception) {
+          std::rethrow_exception(exception);
+        }
+      }
+    } else {
+      for (std::size_t i = 0; i < ranges.size(); i++) {
+        launch(i);
+      }
+    }
+
+    return instances;
+  }
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_PARTITION_HPP__
@@ -0,0 +1,164 @@
+#ifndef __POLK_POLICY_CACHE_HPP__
+#define __POLK_POLICY_CACHE_HPP__
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "auto_tiling.hpp"
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * Check if two arrays have the same values.
+ * @tparam T Value type.
+ * @tparam size Size of the arrays.
+ * @param lhs First array.
+ * @param rhs Second array.
+ * @return True if all values are equal.
+ */
+template <typename T, std::size_t size>
+bool isSameArray(Kokkos::Array<T, size> const &lhs,
+                 Kokkos::Array<T, size> const &rhs) {
+  for (std::size_t i = 0; i < size; i++) {
+    if (lhs[i] != rhs[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Check if two execution parameters give the same policy.
+ * Only the runtime values used by `getPolicy` are compared, the others being
+ * part of the type: the range, its compact range if any, the tile, the
+ * execution space instance and the occupancy.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @param lhs First execution parameters.
+ * @param rhs Second execution parameters.
+ * @return True if both execution parameters give the same policy.
+ */
+template <ExecutionParametersType ExecutionParameters>
+bool isSamePolicy(ExecutionParameters const &lhs,
+                  ExecutionParameters const &rhs) {
+  auto const lhsRange = lhs.getRange();
+  auto const rhsRange = rhs.getRange();
+
+  if (!isSameArray(lhsRange.getBegin(), rhsRange.getBegin()) ||
+      !isSameArray(lhsRange.getEnd(), rhsRange.getEnd())) {
+    return false;
+  }
+
+  if constexpr (CompactedRangeType<decltype(lhs.getRange())>) {
+    if (!isSameArray(lhsRange.getCompactRange().getEnd(),
+                     rhsRange.getCompactRange().getEnd())) {
+      return false;
+    }
+  }
+
+  if constexpr (TilingType<decltype(lhs.getTiling())>) {
+    if (!isSameArray(lhs.getTiling().getTile(), rhs.getTiling().getTile())) {
+      return false;
+    }
+  } else if constexpr (AutoTilingType<decltype(lhs.getTiling())>) {
+    if (lhs.getTiling().getBytesPerIteration() !=
+        rhs.getTiling().getBytesPerIteration()) {
+      return false;
+    }
+  }
+
+  if constexpr (ExecutionParameters::hasExecutionSpace()) {
+    if (!(lhs.getExecutionSpace() == rhs.getExecutionSpace())) {
+      return false;
+    }
+  }
+
+  if constexpr (ExecutionParameters::hasOccupancy()) {
+    if (lhs.getOccupancy().getPercent() != rhs.getOccupancy().getPercent()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace impl
+
+/**
+ * Cached policy class.
+ * Keeps the last policy retrieved from execution parameters, so that a kernel
+ * launched repeatedly, typically in a time loop, does not build and validate
+ * its policy again (including computing an automatic tile) as long as the
+ * label, the range, the tile, the execution space instance and the occupancy
+ * are unchanged. There should be one cached policy per launch site.
+ * @tparam ExecutionParameters Execution parameters class, which must have a
+ * range.
+ */
+template <ExecutionParametersType ExecutionParameters> class CachedPolicy {
+  static_assert(ExecutionParameters::hasRange(), "No range set");
+
+public:
+  /**
+   * Type of the Kokkos policy.
+   */
+  using Policy = decltype(std::declval<ExecutionParameters const &>()
+                              .getPolicy());
+
+private:
+  std::string mLabel;
+  std::optional<ExecutionParameters> mParameters;
+  std::optional<Policy> mPolicy;
+  std::size_t mMissCount = 0;
+
+public:
+  /**
+   * Getter for the policy.
+   * The policy is built only if the label or the execution parameters differ
+   * from the ones of the previous call.
+   * @param label Label of the kernel.
+   * @param parameters Execution parameters.
+   * @return Kokkos policy, valid until the next call.
+   */
+  Policy const &getPolicy(std::string_view const label,
+                          ExecutionParameters const &parameters) {
+    if (!mPolicy || label != mLabel ||
+        !impl::isSamePolicy(*mParameters, parameters)) {
+      mLabel = label;
+      mParameters = parameters;
+      mPolicy = parameters.getPolicy();
+      mMissCount++;
+    }
+
+    return *mPolicy;
+  }
+
+  /**
+   * Getter for the number of times the policy has been built.
+   * @return Number of cache misses.
+   */
+  std::size_t getMissCount() const { return mMissCount; }
+
+  /**
+   * Forget the cached policy.
+   */
+  void clear() {
+    mLabel.clear();
+    mParameters.reset();
+    mPolicy.reset();
+  }
+};
+
+} // namespace polk
+
+#endif // ifndef __POLK_POLICY_CACHE_HPP__
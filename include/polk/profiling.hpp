@@ -0,0 +1,335 @@
+#ifndef __POLK_PROFILING_HPP__
+#define __POLK_PROFILING_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Profiling record of a kernel launch.
+ */
+struct KernelRecord {
+  std::string mLabel;
+  std::string mExecutionSpace;
+  int mRank;
+  std::vector<std::size_t> mExtents;
+  std::vector<std::size_t> mTile;
+  double mSeconds;
+};
+
+/**
+ * Sink receiving the profiling records.
+ */
+using ProfilingSink = std::function<void(KernelRecord const &)>;
+
+/**
+ * Get the default path of the profiling summary file.
+ * @return Value of the environment variable `POLK_PROFILING_OUTPUT` if set,
+ * `polk_profiling.csv` in the working directory otherwise.
+ */
+inline std::string getDefaultProfilingOutputPath() {
+  char const *path = std::getenv("POLK_PROFILING_OUTPUT");
+  return path != nullptr ? path : "polk_profiling.csv";
+}
+
+/**
+ * Check if profiling is requested by the environment.
+ * @return True if the environment variable `POLK_PROFILING` is set to 1.
+ */
+inline bool isProfilingRequested() {
+  char const *isRequested = std::getenv("POLK_PROFILING");
+  return isRequested != nullptr && std::string(isRequested) == "1";
+}
+
+namespace impl {
+
+/**
+ * If the profiler of `polk::parallel_for` is enabled.
+ * Initialized from the environment before `main`, so that launches only read
+ * it, without the static guard of `Profiler::getInstance`.
+ */
+inline std::atomic<bool> isProfilerEnabled = isProfilingRequested();
+
+} // namespace impl
+
+/**
+ * Profiler class.
+ * When enabled, each kernel launched with `polk::parallel_for` is timed, its
+ * execution space instance being fenced before and after, and its record is
+ * given to the sink. Without sink, records are aggregated per label, execution
+ * space, extents and tile, and the summary is written as CSV at
+ * `Kokkos::finalize`.
+ * Profiling is enabled at runtime with `enable` or with the environment
+ * variable `POLK_PROFILING=1`, and is compiled out if `POLK_DISABLE_PROFILING`
+ * is defined.
+ */
+class Profiler {
+  /**
+   * Aggregated records of a kernel.
+   */
+  struct Summary {
+    std::size_t mCalls = 0;
+    double mTotalSeconds = 0;
+    double mMinSeconds = 0;
+    double mMaxSeconds = 0;
+  };
+
+  using SummaryKey = std::tuple<std::string, std::string, int, std::string,
+                                std::string>;
+
+  std::atomic<bool> mIsEnabledStorage = false;
+  std::atomic<bool> &mIsEnabled;
+  std::string mPath;
+  ProfilingSink mSink;
+  std::map<SummaryKey, Summary> mSummaries;
+  mutable std::mutex mMutex;
+
+public:
+  /**
+   * Constructor.
+   * @param path Path of the summary file.
+   * @param isEnabled If profiling is enabled.
+   */
+  explicit Profiler(std::string const &path, bool const isEnabled = false)
+      : mIsEnabledStorage(isEnabled), mIsEnabled(mIsEnabledStorage),
+        mPath(path) {}
+
+private:
+  /**
+   * Constructor of a profiler whose state is stored outside.
+   * @param path Path of the summary file.
+   * @param isEnabled State of the profiler.
+   */
+  Profiler(std::string const &path, std::atomic<bool> &isEnabled)
+      : mIsEnabled(isEnabled), mPath(path) {}
+
+public:
+  /**
+   * Get the profiler used by `polk::parallel_for`.
+   * Its summary is written at `Kokkos::finalize`. Its state is
+   * `impl::isProfilerEnabled`, which launches check instead of calling this
+   * function.
+   * @return Profiler writing its summary at `getDefaultProfilingOutputPath()`,
+   * enabled if `isProfilingRequested()`.
+   */
+  static Profiler &getInstance() {
+    static Profiler instance(getDefaultProfilingOutputPath(),
+                             impl::isProfilerEnabled);
+    static std::once_flag finalizeHookFlag;
+    std::call_once(finalizeHookFlag, []() {
+      Kokkos::push_finalize_hook([]() { instance.writeSummary(); });
+    });
+    return instance;
+  }
+
+  /**
+   * Enable profiling.
+   */
+  void enable() { mIsEnabled = true; }
+
+  /**
+   * Disable profiling.
+   */
+  void disable() { mIsEnabled = false; }
+
+  /**
+   * Check if profiling is enabled.
+   * @return True if enabled.
+   */
+  bool isEnabled() const {
+#ifdef POLK_DISABLE_PROFILING
+    return false;
+#else
+    return mIsEnabled.load(std::memory_order_relaxed);
+#endif
+  }
+
+  /**
+   * Set the sink receiving the records.
+   * @param sink Sink, or an empty function to aggregate the records in the
+   * summary.
+   */
+  void setSink(ProfilingSink const &sink) {
+    std::lock_guard lock(mMutex);
+    mSink = sink;
+  }
+
+  /**
+   * Change the path of the summary file.
+   * @param path Path.
+   */
+  void setPath(std::string const &path) {
+    std::lock_guard lock(mMutex);
+    mPath = path;
+  }
+
+  /**
+   * Getter for the path of the summary file.
+   * @return Path.
+   */
+  std::string getPath() const {
+    std::lock_guard lock(mMutex);
+    return mPath;
+  }
+
+  /**
+   * Give a record to the sink, or aggregate it in the summary.
+   * @param kernelRecord Record.
+   */
+  void record(KernelRecord const &kernelRecord) {
+    std::lock_guard lock(mMutex);
+    if (mSink) {
+      mSink(kernelRecord);
+      return;
+    }
+
+    auto const join = [](std::vector<std::size_t> const &values) {
+      std::string text;
+      for (std::size_t d = 0; d < values.size(); d++) {
+        text += (d > 0 ? "x" : "") + std::to_string(values[d]);
+      }
+      return text;
+    };
+
+    auto const seconds = kernelRecord.mSeconds;
+    auto &summary =
+        mSummaries[{kernelRecord.mLabel, kernelRecord.mExecutionSpace,
+                    kernelRecord.mRank, join(kernelRecord.mExtents),
+                    join(kernelRecord.mTile)}];
+    summary.mMinSeconds = summary.mCalls == 0
+                              ? seconds
+                              : std::min(summary.mMinSeconds, seconds);
+    summary.mMaxSeconds = std::max(summary.mMaxSeconds, seconds);
+    summary.mTotalSeconds += seconds;
+    summary.mCalls++;
+  }
+
+  /**
+   * Write the summary as CSV, if it is not empty.
+   * Columns are the label, the execution space, the rank, the extents, the
+   * tile that is launched (empty if none is given to the policy), the number
+   * of calls, and the total, minimum and maximum durations in seconds.
+   */
+  void writeSummary() const {
+    std::lock_guard lock(mMutex);
+    if (mSummaries.empty()) {
+      return;
+    }
+
+    std::ofstream file(mPath);
+    if (!file) {
+      return;
+    }
+
+    auto const quote = [](std::string const &text) {
+      std::string quoted = "\"";
+      for (auto const character : text) {
+        quoted += character == '"' ? "\"\"" : std::string(1, character);
+      }
+      return quoted + "\"";
+    };
+
+    file << "label,execution_space,rank,extents,tile,calls,total_s,min_s,"
+            "max_s\n";
+    for (auto const &[key, summary] : mSummaries) {
+      auto const &[label, executionSpace, rank, extents, tile] = key;
+      file << quote(label) << ',' << executionSpace << ',' << rank << ','
+           << extents << ',' << tile << ',' << summary.mCalls << ','
+           << summary.mTotalSeconds << ',' << summary.mMinSeconds << ','
+           << summary.mMaxSeconds << '\n';
+    }
+  }
+
+  /**
+   * Discard the summary.
+   */
+  void clear() {
+    std::lock_guard lock(mMutex);
+    mSummaries.clear();
+  }
+};
+
+namespace impl {
+
+/**
+ * Launch a kernel and record it.
+ * The execution space instance of the policy is fenced before and after the
+ * launch, so that the duration only covers the kernel.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Launch Launch function class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters of the kernel.
+ * @param launch Function launching the kernel. If it takes a pointer to a
+ * tile, it sets it to the tile that is launched, which is recorded instead of
+ * the tile of the parameters.
+ */
+template <typename ExecutionParameters, typename Launch>
+void profile(std::string const &label, ExecutionParameters const &parameters,
+             Launch const &launch) {
+  auto const space = parameters.getPolicy().space();
+
+  KernelRecord record;
+  record.mLabel = label;
+  record.mExecutionSpace = space.name();
+  if constexpr (ExecutionParameters::hasLeague()) {
+    record.mRank = 1;
+    record.mExtents = {parameters.getLeague().getSize()};
+  } else {
+    auto const extents = getExtents(parameters.getRange());
+    record.mRank = ExecutionParameters::getRank();
+    record.mExtents.assign(extents.data(), extents.data() + extents.size());
+    if constexpr (ExecutionParameters::hasPolicyTile() &&
+                  !std::is_invocable_v<Launch, std::vector<std::size_t> *>) {
+      auto const tile = parameters.getPolicyTile();
+      record.mTile.assign(tile.data(), tile.data() + tile.size());
+    }
+  }
+
+  space.fence("polk: before profiling " + label);
+  Kokkos::Timer timer;
+  if constexpr (std::is_invocable_v<Launch, std::vector<std::size_t> *>) {
+    launch(&record.mTile);
+  } else {
+    launch();
+  }
+  space.fence("polk: after profiling " + label);
+  record.mSeconds = timer.seconds();
+
+  Profiler::getInstance().record(record);
+}
+
+/**
+ * Check if launches are profiled.
+ * @return True if the profiler of `polk::parallel_for` is enabled.
+ */
+inline bool isProfiling() {
+#ifdef POLK_DISABLE_PROFILING
+  return false;
+#else
+  return isProfilerEnabled.load(std::memory_order_relaxed);
+#endif
+}
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_PROFILING_HPP__
@@ -0,0 +1,105 @@
+#ifndef __POLK_REDUCER_HPP__
+#define __POLK_REDUCER_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+
+#include <Kokkos_Core.hpp>
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Reducer class.
+ * Kokkos reducers used by `polk::parallel_reduce`, each of them receiving one
+ * result. Several reducers are fused in a single pass over the range, the
+ * kernel receiving one accumulator per reducer.
+ * @tparam KokkosReducers Kokkos reducer classes (e.g. `Kokkos::Sum<double>`,
+ * `Kokkos::Max<double>`, `Kokkos::MinLoc<double, int>`, or custom reducers
+ * following the Kokkos reducer concept).
+ */
+template <typename... KokkosReducers> struct Reducer {
+  static_assert(sizeof...(KokkosReducers) > 0,
+                "At least one reducer must be given");
+  static_assert((Kokkos::is_reducer_v<KokkosReducers> && ...),
+                "Reducers must be Kokkos reducers");
+
+public:
+  /**
+   * Marker to identify the class as a reducer.
+   */
+  using ReducerType = Reducer<KokkosReducers...>;
+
+  /**
+   * Types of the results of the reducers.
+   */
+  using ValueTypes = std::tuple<typename KokkosReducers::value_type...>;
+
+  /**
+   * Create the Kokkos reducers.
+   * @param results Results of the reducers.
+   * @return Tuple of Kokkos reducers bound to the results.
+   */
+  static auto
+  createKokkosReducers(typename KokkosReducers::value_type &...results) {
+    return std::make_tuple(KokkosReducers(results)...);
+  }
+
+  /**
+   * Getter for the number of reducers.
+   * @return Number of reducers.
+   */
+  static std::size_t constexpr getSize() { return sizeof...(KokkosReducers); }
+};
+
+/**
+ * Concept for the reducer.
+ */
+template <typename T>
+concept ReducerType = std::same_as<T, typename T::ReducerType>;
+
+/**
+ * Default reducer.
+ */
+struct UnknownReducer {};
+
+namespace impl {
+
+/**
+ * Number of chunks given to each unit of concurrency for reductions and
+ * scans over a single-dimensional range.
+ */
+std::size_t constexpr reductionChunksPerThread = 4;
+
+/**
+ * Minimum chunk size of a reduction or a scan over a single-dimensional
+ * range.
+ */
+std::size_t constexpr reductionMinChunk = 64;
+
+/**
+ * Compute the chunk size of a reduction or a scan over a single-dimensional
+ * range.
+ * Each chunk is a unit of work handed out by the host backends, so a few
+ * large chunks per unit of concurrency limit the scheduling overhead while
+ * leaving some slack for load balancing. The chunk size is not smaller than
+ * `reductionMinChunk`, so that small ranges are not scheduled index by index.
+ * @param extent Extent of the range.
+ * @param concurrency Concurrency of the execution space.
+ * @return Chunk size.
+ */
+inline std::size_t getReductionChunk(std::size_t const extent,
+                                     std::size_t const concurrency) {
+  std::size_t const chunkCount =
+      reductionChunksPerThread * std::max<std::size_t>(concurrency, 1);
+  return std::max<std::size_t>(extent / chunkCount, reductionMinChunk);
+}
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_REDUCER_HPP__
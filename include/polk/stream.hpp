@@ -0,0 +1,249 @@
+#ifndef __POLK_STREAM_HPP__
+#define __POLK_STREAM_HPP__
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "parallel.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Streamed class.
+ * Split of a range along its first dimension into chunks of a fixed extent,
+ * launched one after the other while the data of the next chunk is staged.
+ */
+class Streamed {
+  static std::size_t constexpr mInstanceCount = 2;
+  std::size_t mChunkExtent;
+
+public:
+  /**
+   * Marker to identify the class as a streamed split.
+   */
+  using StreamedType = Streamed;
+
+  Streamed() = delete;
+
+  /**
+   * Constructor.
+   * @param chunkExtent Extent of the chunks along the first dimension.
+   * @throw std::invalid_argument If the extent is null.
+   */
+  explicit Streamed(std::size_t const chunkExtent) : mChunkExtent(chunkExtent) {
+    if (chunkExtent == 0) {
+      throw std::invalid_argument("Chunk extent must be positive");
+    }
+  }
+
+  /**
+   * Getter for the chunk extent.
+   * @return Extent of the chunks along the first dimension.
+   */
+  std::size_t getChunkExtent() const { return mChunkExtent; }
+
+  /**
+   * Getter for the number of execution space instances used to pipeline the
+   * chunks, which is also the number of buffers the stage callback should
+   * alternate between.
+   * @return Number of instances.
+   */
+  static std::size_t constexpr getInstanceCount() { return mInstanceCount; }
+};
+
+/**
+ * Concept for the streamed split.
+ */
+template <typename T>
+concept StreamedType = std::same_as<T, typename T::StreamedType>;
+
+namespace impl {
+
+/**
+ * Split a range along its first dimension into chunks.
+ * Chunks are contiguous, the last one may be smaller than the others.
+ * @tparam Range Range class.
+ * @param range Range.
+ * @param chunkExtent Extent of the chunks along the first dimension.
+ * @return Chunks, none if the range is empty.
+ */
+template <RangeType Range>
+std::vector<Range> chunkRange(Range const &range,
+                              std::size_t const chunkExtent) {
+  using Index = typename Range::Index;
+  auto const begin = range.getBegin();
+  auto const end = range.getEnd();
+
+  std::vector<Range> ranges;
+  for (Index lower = begin[0]; lower < end[0];) {
+    Index const upper = end[0] - lower > static_cast<Index>(chunkExtent)
+                            ? lower + static_cast<Index>(chunkExtent)
+                            : end[0];
+    auto chunkBegin = begin;
+    auto chunkEnd = end;
+    chunkBegin[0] = lower;
+    chunkEnd[0] = upper;
+    ranges.emplace_back(chunkBegin, chunkEnd);
+    lower = upper;
+  }
+
+  return ranges;
+}
+
+} // namespace impl
+
+/**
+ * Launch a parallel for chunk by chunk, staging the next chunk meanwhile.
+ * The range is split along its first dimension, and the execution space of
+ * the parameters (or the default one) is partitioned into two instances with
+ * `Kokkos::Experimental::partition_space`, chunks alternating between them.
+ * The stage callback of a chunk is called from the host, after the previous
+ * kernel of its instance has completed (so that its buffer can be reused)
+ * and while the kernel of the previous chunk is running; it may enqueue work
+ * on the instance, which is ordered before the kernel of the chunk. On host
+ * execution spaces whose instances are distinct, kernels are launched from a
+ * single worker thread, so that the stage callback runs concurrently. On
+ * other host execution spaces (e.g. `Kokkos::Threads`, whose instances are
+ * copies of the same one), chunks are staged and launched in turn from the
+ * calling thread. On host execution spaces, kernels are complete on return.
+ * On other execution spaces, the launches are asynchronous and the returned
+ * instances must be fenced before using the results.
+ * @tparam ExecutionParameters Execution parameters class.
+ * @tparam Stage Stage callback class.
+ * @tparam Functor Kernel class.
+ * @param label Label of the kernel.
+ * @param parameters Execution parameters.
+ * @param streamed Streamed split.
+ * @param stage Stage callback, called with the index of the chunk, its range
+ * and its execution space instance. The buffer of the chunk is usually
+ * selected by the index modulo `polk::Streamed::getInstanceCount()`.
+ * @param functor Kernel, called with the indices of the range.
+ * @return Execution space instances.
+ */
+template <ExecutionParametersType ExecutionParameters, typename Stage,
+          typename Functor>
+auto parallel_for_streamed(std::string const &label,
+                           ExecutionParameters const &parameters,
+                           Streamed const &streamed, Stage const &stage,
+                           Functor const &functor) {
+  static_assert(ExecutionParameters::hasRange(), "No range set");
+  static_assert(!impl::isCompacted<ExecutionParameters>(),
+                "Strided or weighted range cannot be streamed");
+
+  auto const space = [&parameters]() {
+    if constexpr (ExecutionParameters::hasExecutionSpace()) {
+      return parameters.getExecutionSpace();
+    } else {
+      return Kokkos::DefaultExecutionSpace();
+    }
+  }();
+  using Space = std::remove_cv_t<decltype(space)>;
+  bool constexpr isHost =
+      Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible;
+
+  auto const instances = Kokkos::Experimental::partition_space(space, 1, 1);
+  auto const ranges =
+      impl::chunkRange(parameters.getRange(), streamed.getChunkExtent());
+
+  auto const launch = [&](std::size_t const i) {
+    auto const &instance = instances[i % Streamed::getInstanceCount()];
+    parallel_for(label, parameters.replace(ranges[i]).replace(instance),
+                 functor);
+    if constexpr (isHost) {
+      instance.fence("polk::parallel_for_streamed: wait for chunk");
+    }
+  };
+  auto const prepare = [&](std::size_t const i) {
+    auto const &instance = instances[i % Streamed::getInstanceCount()];
+    instance.fence("polk::parallel_for_streamed: wait for buffer");
+    stage(i, ranges[i], instance);
+  };
+
+  if (ranges.empty()) {
+    return instances;
+  }
+
+  if (!isHost || !impl::areDistinctInstances(instances)) {
+    prepare(0);
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+      launch(i);
+      if (i + 1 < ranges.size()) {
+        prepare(i + 1);
+      }
+    }
+
+    return instances;
+  }
+
+  // a single worker launches the chunks in order, each one once it is staged,
+  // while the calling thread stages the next chunk
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::size_t stagedCount = 0;
+  std::size_t launchedCount = 0;
+  bool isAborted = false;
+
+  std::thread worker([&]() {
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+      {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [&]() { return isAborted || stagedCount > i; });
+        if (isAborted) {
+          return;
+        }
+      }
+
+      launch(i);
+
+      {
+        std::lock_guard lock(mutex);
+        launchedCount = i + 1;
+      }
+      condition.notify_all();
+    }
+  });
+
+  try {
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+      if (i > 0) {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [&]() { return launchedCount + 1 >= i; });
+      }
+
+      prepare(i);
+
+      {
+        std::lock_guard lock(mutex);
+        stagedCount = i + 1;
+      }
+      condition.notify_all();
+    }
+  } catch (...) {
+    {
+      std::lock_guard lock(mutex);
+      isAborted = true;
+    }
+    condition.notify_all();
+    worker.join();
+    throw;
+  }
+
+  worker.join();
+  return instances;
+}
+
+} // namespace polk
+
+#endif // ifndef __POLK_STREAM_HPP__
@@ -0,0 +1,228 @@
+#ifndef __POLK_TEAM_HPP__
+#define __POLK_TEAM_HPP__
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * League class.
+ * Number of teams of a team policy. Setting it makes the execution policy
+ * creator build a `Kokkos::TeamPolicy` instead of a range policy.
+ */
+struct League {
+  std::size_t mSize;
+
+public:
+  /**
+   * Marker to identify the class as a league.
+   */
+  using LeagueType = League;
+
+  League() = delete;
+
+  /**
+   * Constructor.
+   * @param size Number of teams.
+   * @throw std::invalid_argument If the size cannot be given to Kokkos, which
+   * stores it as an `int`.
+   */
+  constexpr League(std::size_t size) : mSize(size) {
+    if (size > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+      throw std::invalid_argument("League size out of bounds");
+    }
+  }
+
+  /**
+   * Getter for the number of teams.
+   * @return Number of teams.
+   */
+  std::size_t constexpr getSize() const { return mSize; }
+};
+
+/**
+ * Concept for the league.
+ */
+template <typename T>
+concept LeagueType = std::same_as<T, typename T::LeagueType>;
+
+/**
+ * Team size class.
+ * Number of threads per team, or `Kokkos::AUTO` to let Kokkos decide.
+ */
+struct TeamSize {
+  int mSize;
+  bool mIsAuto;
+
+public:
+  /**
+   * Marker to identify the class as a team size.
+   */
+  using TeamSizeType = TeamSize;
+
+  TeamSize() = delete;
+
+  /**
+   * Constructor.
+   * @param size Number of threads per team.
+   */
+  constexpr TeamSize(int size) : mSize(size), mIsAuto(false) {}
+
+  /**
+   * Automatic constructor.
+   * @param automatic `Kokkos::AUTO`.
+   */
+  constexpr TeamSize([[maybe_unused]] Kokkos::AUTO_t const &automatic)
+      : mSize(0), mIsAuto(true) {}
+
+  /**
+   * Getter for the number of threads per team.
+   * @return Number of threads, meaningless if automatic.
+   */
+  int constexpr getSize() const { return mSize; }
+
+  /**
+   * Check if the team size is chosen by Kokkos.
+   * @return True if automatic.
+   */
+  bool constexpr isAuto() const { return mIsAuto; }
+};
+
+/**
+ * Concept for the team size.
+ */
+template <typename T>
+concept TeamSizeType = std::same_as<T, typename T::TeamSizeType>;
+
+/**
+ * Vector length class.
+ * Number of vector lanes per thread, or `Kokkos::AUTO` to let Kokkos decide.
+ */
+struct VectorLength {
+  int mLength;
+  bool mIsAuto;
+
+public:
+  /**
+   * Marker to identify the class as a vector length.
+   */
+  using VectorLengthType = VectorLength;
+
+  VectorLength() = delete;
+
+  /**
+   * Constructor.
+   * @param length Number of vector lanes per thread.
+   */
+  constexpr VectorLength(int length) : mLength(length), mIsAuto(false) {}
+
+  /**
+   * Automatic constructor.
+   * @param automatic `Kokkos::AUTO`.
+   */
+  constexpr VectorLength([[maybe_unused]] Kokkos::AUTO_t const &automatic)
+      : mLength(1), mIsAuto(true) {}
+
+  /**
+   * Getter for the number of vector lanes per thread.
+   * @return Number of vector lanes, meaningless if automatic.
+   */
+  int constexpr getLength() const { return mLength; }
+
+  /**
+   * Check if the vector length is chosen by Kokkos.
+   * @return True if automatic.
+   */
+  bool constexpr isAuto() const { return mIsAuto; }
+};
+
+/**
+ * Concept for the vector length.
+ */
+template <typename T>
+concept VectorLengthType = std::same_as<T, typename T::VectorLengthType>;
+
+/**
+ * Scratch memory class.
+ * Amount of scratch memory requested for a scratch level, per team and per
+ * thread.
+ * @tparam level Scratch level, 0 or 1.
+ */
+template <int level> struct Scratch {
+  static_assert(level == 0 || level == 1, "Scratch level must be 0 or 1");
+
+  static int constexpr mLevel = level;
+  std::size_t mPerTeam;
+  std::size_t mPerThread;
+
+public:
+  /**
+   * Marker to identify the class as a scratch memory request.
+   */
+  using ScratchType = Scratch<level>;
+
+  Scratch() = delete;
+
+  /**
+   * Constructor.
+   * @param perTeam Bytes of scratch memory per team.
+   * @param perThread Bytes of scratch memory per thread.
+   */
+  constexpr Scratch(std::size_t perTeam, std::size_t perThread = 0)
+      : mPerTeam(perTeam), mPerThread(perThread) {}
+
+  /**
+   * Getter for the bytes of scratch memory per team.
+   * @return Bytes per team.
+   */
+  std::size_t constexpr getPerTeam() const { return mPerTeam; }
+
+  /**
+   * Getter for the bytes of scratch memory per thread.
+   * @return Bytes per thread.
+   */
+  std::size_t constexpr getPerThread() const { return mPerThread; }
+
+  /**
+   * Getter for the level.
+   * @return Scratch level.
+   */
+  static int constexpr getLevel() { return mLevel; }
+};
+
+/**
+ * Concept for the scratch memory request.
+ */
+template <typename T>
+concept ScratchType = std::same_as<T, typename T::ScratchType>;
+
+/**
+ * Default league.
+ */
+struct UnknownLeague {};
+
+/**
+ * Default team size.
+ */
+struct UnknownTeamSize {};
+
+/**
+ * Default vector length.
+ */
+struct UnknownVectorLength {};
+
+/**
+ * Default scratch memory request.
+ */
+struct UnknownScratch {};
+
+} // namespace polk
+
+#endif // ifndef __POLK_TEAM_HPP__
@@ -0,0 +1,484 @@
+#ifndef __POLK_TILE_ORDER_HPP__
+#define __POLK_TILE_ORDER_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * Number of bits needed to represent the values below a count.
+ * @param count Count of values.
+ * @return Smallest number of bits such that 2 to this power is not less than
+ * the count.
+ */
+KOKKOS_INLINE_FUNCTION int getBitCount(std::size_t const count) {
+  int bits = 0;
+  while ((std::size_t(1) << bits) < count) {
+    bits++;
+  }
+
+  return bits;
+}
+
+/**
+ * Decode a position along a Morton curve.
+ * Dimensions are interleaved from the innermost one, and a dimension stops
+ * being interleaved once its bits are exhausted, so that each dimension is
+ * only padded to a power of two.
+ * @tparam rank Rank of the curve.
+ * @param code Position along the curve.
+ * @param bits Number of bits per dimension.
+ * @param isInnerLeft If the first dimension is the innermost one.
+ * @return Coordinates.
+ */
+template <std::size_t rank>
+KOKKOS_INLINE_FUNCTION Kokkos::Array<std::size_t, rank>
+decodeMorton(std::size_t code, Kokkos::Array<int, rank> const &bits,
+             bool const isInnerLeft) {
+  Kokkos::Array<std::size_t, rank> coordinates;
+  int maxBits = 0;
+  for (std::size_t d = 0; d < rank; d++) {
+    coordinates[d] = 0;
+    maxBits = bits[d] > maxBits ? bits[d] : maxBits;
+  }
+
+  for (int b = 0; b < maxBits; b++) {
+    for (std::size_t i = 0; i < rank; i++) {
+      std::size_t const d = isInnerLeft ? i : rank - 1 - i;
+      if (b < bits[d]) {
+        coordinates[d] |= (code & 1) << b;
+        code >>= 1;
+      }
+    }
+  }
+
+  return coordinates;
+}
+
+/**
+ * Encode coordinates into a position along a Morton curve.
+ * Inverse of `decodeMorton`.
+ * @tparam rank Rank of the curve.
+ * @param coordinates Coordinates.
+ * @param bits Number of bits per dimension.
+ * @param isInnerLeft If the first dimension is the innermost one.
+ * @return Position along the curve.
+ */
+template <std::size_t rank>
+std::size_t encodeMorton(Kokkos::Array<std::size_t, rank> const &coordinates,
+                         Kokkos::Array<int, rank> const &bits,
+                         bool const isInnerLeft) {
+  int maxBits = 0;
+  for (std::size_t d = 0; d < rank; d++) {
+    maxBits = bits[d] > maxBits ? bits[d] : maxBits;
+  }
+
+  std::size_t code = 0;
+  int shift = 0;
+  for (int b = 0; b < maxBits; b++) {
+    for (std::size_t i = 0; i < rank; i++) {
+      std::size_t const d = isInnerLeft ? i : rank - 1 - i;
+      if (b < bits[d]) {
+        code |= ((coordinates[d] >> b) & 1) << shift;
+        shift++;
+      }
+    }
+  }
+
+  return code;
+}
+
+/**
+ * Decode a position along a Hilbert curve.
+ * @param code Position along the curve.
+ * @param side Side of the square covered by the curve, a power of two.
+ * @return Coordinates, the first one varying first along the curve.
+ */
+KOKKOS_INLINE_FUNCTION Kokkos::Array<std::size_t, 2>
+decodeHilbert(std::size_t code, std::size_t const side) {
+  std::size_t x = 0;
+  std::size_t y = 0;
+  for (std::size_t s = 1; s < side; s *= 2) {
+    std::size_t const rx = 1 & (code / 2);
+    std::size_t const ry = 1 & (code ^ rx);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = s - 1 - x;
+        y = s - 1 - y;
+      }
+      std::size_t const t = x;
+      x = y;
+      y = t;
+    }
+    x += s * rx;
+    y += s * ry;
+    code /= 4;
+  }
+
+  return {x, y};
+}
+
+/**
+ * Encode coordinates into a position along a Hilbert curve.
+ * Inverse of `decodeHilbert`.
+ * @param x First coordinate.
+ * @param y Second coordinate.
+ * @param side Side of the square covered by the curve, a power of two.
+ * @return Position along the curve.
+ */
+inline std::size_t encodeHilbert(std::size_t x, std::size_t y,
+                                 std::size_t const side) {
+  std::size_t code = 0;
+  for (std::size_t s = side / 2; s > 0; s /= 2) {
+    std::size_t const rx = (x & s) > 0 ? 1 : 0;
+    std::size_t const ry = (y & s) > 0 ? 1 : 0;
+    code += s * s * ((3 * rx) ^ ry);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = side - 1 - x;
+        y = side - 1 - y;
+      }
+      std::size_t const t = x;
+      x = y;
+      y = t;
+    }
+  }
+
+  return code;
+}
+
+/**
+ * Cache of the sorted positions of the tiles along a curve.
+ * Positions only depend on the number of tiles per dimension and on the
+ * innermost dimension, so that they are computed and copied once, then shared
+ * by all launches with the same tile counts. The cache is cleared at
+ * `Kokkos::finalize`.
+ * @tparam Curve Space-filling curve.
+ * @tparam rank Rank of the range.
+ * @tparam MemorySpace Memory space where the positions are stored.
+ */
+template <typename Curve, std::size_t rank, typename MemorySpace>
+class TileCodesCache {
+public:
+  using Codes = Kokkos::View<std::size_t const *, MemorySpace>;
+
+private:
+  using Key = std::pair<std::vector<std::size_t>, bool>;
+
+  mutable std::mutex mMutex;
+  std::map<Key, Codes> mCodes;
+
+public:
+  /**
+   * Get the cache of the curve and memory space.
+   * @return Cache.
+   */
+  static TileCodesCache &getInstance() {
+    static TileCodesCache instance;
+    [[maybe_unused]] static bool const isHooked = []() {
+      Kokkos::push_finalize_hook([]() { instance.clear(); });
+      return true;
+    }();
+    return instance;
+  }
+
+  /**
+   * Find the positions of tile counts.
+   * @param counts Number of tiles per dimension.
+   * @param isInnerLeft If the first dimension is the innermost one.
+   * @return Positions, or an empty view if they are not cached.
+   */
+  Codes find(Kokkos::Array<std::size_t, rank> const &counts,
+             bool const isInnerLeft) const {
+    std::lock_guard lock(mMutex);
+    auto const iterator = mCodes.find(getKey(counts, isInnerLeft));
+    return iterator != mCodes.end() ? iterator->second : Codes();
+  }
+
+  /**
+   * Store the positions of tile counts.
+   * @param counts Number of tiles per dimension.
+   * @param isInnerLeft If the first dimension is the innermost one.
+   * @param codes Positions.
+   */
+  void insert(Kokkos::Array<std::size_t, rank> const &counts,
+              bool const isInnerLeft, Codes const &codes) {
+    std::lock_guard lock(mMutex);
+    mCodes[getKey(counts, isInnerLeft)] = codes;
+  }
+
+  /**
+   * Release all positions.
+   */
+  void clear() {
+    std::lock_guard lock(mMutex);
+    mCodes.clear();
+  }
+
+private:
+  /**
+   * Create the key of tile counts.
+   * @param counts Number of tiles per dimension.
+   * @param isInnerLeft If the first dimension is the innermost one.
+   * @return Key.
+   */
+  static Key getKey(Kokkos::Array<std::size_t, rank> const &counts,
+                    bool const isInnerLeft) {
+    return {std::vector<std::size_t>(counts.data(), counts.data() + rank),
+            isInnerLeft};
+  }
+};
+
+/**
+ * Ordering of the tiles of a range along a space-filling curve.
+ * The curve covers the tiles of the range padded to powers of two (to a
+ * square for Hilbert). The positions of the tiles of the range are sorted on
+ * the host and copied to the memory space on the first use of given tile
+ * counts, then taken from a `TileCodesCache`, so that only these tiles are
+ * launched. Copies of an ordering share the same positions.
+ * @tparam Curve Space-filling curve.
+ * @tparam rank Rank of the range.
+ * @tparam MemorySpace Memory space of the launch, where the positions are
+ * stored.
+ */
+template <typename Curve, std::size_t rank, typename MemorySpace>
+struct TileOrdering {
+  static_assert(!std::is_same_v<Curve, Hilbert> || rank == 2,
+                "Hilbert tile order requires a rank of 2");
+
+  Kokkos::Array<std::size_t, rank> mTile;
+  Kokkos::Array<std::size_t, rank> mCounts;
+  Kokkos::Array<int, rank> mBits;
+  Kokkos::View<std::size_t const *, MemorySpace> mCodes;
+  bool mIsInnerLeft;
+
+  /**
+   * Constructor.
+   * @tparam ExecutionSpace Execution space class.
+   * @param space Execution space instance of the launch, on which the
+   * positions are copied.
+   * @param extents Extents of the range.
+   * @param tile Tile.
+   * @param isInnerLeft If the first dimension is the innermost one.
+   */
+  template <typename ExecutionSpace>
+  TileOrdering(ExecutionSpace const &space,
+               Kokkos::Array<std::size_t, rank> const &extents,
+               Kokkos::Array<std::size_t, rank> const &tile,
+               bool const isInnerLeft)
+      : mTile(tile), mIsInnerLeft(isInnerLeft) {
+    int maxBits = 0;
+    for (std::size_t d = 0; d < rank; d++) {
+      mTile[d] = tile[d] > 0 ? tile[d] : 1;
+      mCounts[d] = (extents[d] + mTile[d] - 1) / mTile[d];
+      mBits[d] = getBitCount(mCounts[d]);
+      maxBits = mBits[d] > maxBits ? mBits[d] : maxBits;
+    }
+
+    if constexpr (std::is_same_v<Curve, Hilbert>) {
+      for (std::size_t d = 0; d < rank; d++) {
+        mBits[d] = maxBits;
+      }
+    }
+
+    auto &cache = TileCodesCache<Curve, rank, MemorySpace>::getInstance();
+    mCodes = cache.find(mCounts, mIsInnerLeft);
+    if (!mCodes.is_allocated()) {
+      mCodes = createCodes(space);
+      cache.insert(mCounts, mIsInnerLeft, mCodes);
+    }
+  }
+
+  /**
+   * Getter for the number of tiles launched.
+   * @return Number of tiles of the range, 0 if the range is empty.
+   */
+  std::size_t getLength() const { return mCodes.extent(0); }
+
+  /**
+   * Get the coordinates of a tile.
+   * @param position Rank of the tile along the curve.
+   * @return Coordinates of the tile, in tiles.
+   */
+  KOKKOS_FUNCTION Kokkos::Array<std::size_t, rank>
+  getCoordinates(std::size_t const position) const {
+    std::size_t const code = mCodes(position);
+    if constexpr (std::is_same_v<Curve, Hilbert>) {
+      auto const curve = decodeHilbert(code, std::size_t(1) << mBits[0]);
+      Kokkos::Array<std::size_t, rank> coordinates;
+      coordinates[mIsInnerLeft ? 0 : 1] = curve[0];
+      coordinates[mIsInnerLeft ? 1 : 0] = curve[1];
+      return coordinates;
+    } else {
+      return decodeMorton(code, mBits, mIsInnerLeft);
+    }
+  }
+
+private:
+  /**
+   * Compute the sorted positions of the tiles and copy them.
+   * The copy is made on the launch instance, which is then fenced so that the
+   * host buffer can be released, without fencing other instances.
+   * @tparam ExecutionSpace Execution space class.
+   * @param space Execution space instance of the launch.
+   * @return Positions.
+   */
+  template <typename ExecutionSpace>
+  Kokkos::View<std::size_t *, MemorySpace>
+  createCodes(ExecutionSpace const &space) const {
+    std::size_t length = 1;
+    for (std::size_t d = 0; d < rank; d++) {
+      length *= mCounts[d];
+    }
+
+    Kokkos::View<std::size_t *, MemorySpace> codes(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "polk::TileOrder::codes"),
+        length);
+    auto const codesHost =
+        Kokkos::create_mirror_view(Kokkos::WithoutInitializing, codes);
+    Kokkos::Array<std::size_t, rank> coordinates;
+    for (std::size_t i = 0; i < length; i++) {
+      std::size_t remainder = i;
+      for (std::size_t d = 0; d < rank; d++) {
+        coordinates[d] = remainder % mCounts[d];
+        remainder /= mCounts[d];
+      }
+      codesHost(i) = encode(coordinates);
+    }
+    std::sort(codesHost.data(), codesHost.data() + length);
+
+    Kokkos::deep_copy(space, codes, codesHost);
+    space.fence("polk::TileOrder: wait for codes");
+
+    return codes;
+  }
+
+  /**
+   * Encode the coordinates of a tile into its position along the curve.
+   * @param coordinates Coordinates of the tile.
+   * @return Position along the curve.
+   */
+  std::size_t
+  encode(Kokkos::Array<std::size_t, rank> const &coordinates) const {
+    if constexpr (std::is_same_v<Curve, Hilbert>) {
+      return encodeHilbert(coordinates[mIsInnerLeft ? 0 : 1],
+                           coordinates[mIsInnerLeft ? 1 : 0],
+                           std::size_t(1) << mBits[0]);
+    } else {
+      return encodeMorton(coordinates, mBits, mIsInnerLeft);
+    }
+  }
+};
+
+/**
+ * Kernel wrapper launching one tile per index along a space-filling curve.
+ * @tparam Curve Space-filling curve.
+ * @tparam rank Rank of the range.
+ * @tparam Index Index type of the range.
+ * @tparam MemorySpace Memory space of the launch, where the positions are
+ * stored.
+ * @tparam Functor Kernel class, called with one index per dimension.
+ */
+template <typename Curve, std::size_t rank, typename Index,
+          typename MemorySpace, typename Functor>
+struct TileOrderFunctor {
+  Functor mFunctor;
+  Kokkos::Array<Index, rank> mBegin;
+  Kokkos::Array<Index, rank> mEnd;
+  TileOrdering<Curve, rank, MemorySpace> mOrdering;
+
+  /**
+   * Constructor.
+   * @param functor Kernel.
+   * @param begin Begin coordinates of the range.
+   * @param end End coordinates of the range.
+   * @param ordering Ordering of the tiles of the range.
+   */
+  TileOrderFunctor(Functor const &functor,
+                   Kokkos::Array<Index, rank> const &begin,
+                   Kokkos::Array<Index, rank> const &end,
+                   TileOrdering<Curve, rank, MemorySpace> const &ordering)
+      : mFunctor(functor), mBegin(begin), mEnd(end), mOrdering(ordering) {}
+
+  /**
+   * Getter for the number of tiles launched.
+   * @return Number of tiles of the range, 0 if the range is empty.
+   */
+  std::size_t getLength() const { return mOrdering.getLength(); }
+
+  /**
+   * Launch the kernel on a tile.
+   * @param position Rank of the tile along the curve.
+   */
+  KOKKOS_FUNCTION void operator()(std::size_t const position) const {
+    auto const coordinates = mOrdering.getCoordinates(position);
+    auto const &tile = mOrdering.mTile;
+
+    Kokkos::Array<Index, rank> lower;
+    Kokkos::Array<Index, rank> upper;
+    for (std::size_t d = 0; d < rank; d++) {
+      lower[d] = mBegin[d] + static_cast<Index>(coordinates[d] * tile[d]);
+      upper[d] = lower[d] + static_cast<Index>(tile[d]) < mEnd[d]
+                     ? lower[d] + static_cast<Index>(tile[d])
+                     : mEnd[d];
+    }
+
+    Kokkos::Array<Index, rank> point;
+    iterate<0>(lower, upper, point);
+  }
+
+private:
+  /**
+   * Iterate over the points of a tile, the innermost dimension last.
+   * @tparam depth Depth of the loop nest.
+   * @param lower Lower coordinates of the tile.
+   * @param upper Upper coordinates of the tile.
+   * @param point Current point.
+   */
+  template <std::size_t depth>
+  KOKKOS_INLINE_FUNCTION void iterate(Kokkos::Array<Index, rank> const &lower,
+                                      Kokkos::Array<Index, rank> const &upper,
+                                      Kokkos::Array<Index, rank> &point) const {
+    if constexpr (depth == rank) {
+      call(point, std::make_index_sequence<rank>());
+    } else {
+      std::size_t const d =
+          mOrdering.mIsInnerLeft ? rank - 1 - depth : depth;
+      for (point[d] = lower[d]; point[d] < upper[d]; point[d]++) {
+        iterate<depth + 1>(lower, upper, point);
+      }
+    }
+  }
+
+  /**
+   * Call the kernel on a point.
+   * @param point Point.
+   */
+  template <std::size_t... d>
+  KOKKOS_INLINE_FUNCTION void call(Kokkos::Array<Index, rank> const &point,
+                                   std::index_sequence<d...>) const {
+    mFunctor(point[d]...);
+  }
+};
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_TILE_ORDER_HPP__
@@ -0,0 +1,375 @@
+#ifndef __POLK_TUNING_HPP__
+#define __POLK_TUNING_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Get the default path of the tuning cache file.
+ * @return Value of the environment variable `POLK_TUNING_CACHE` if set,
+ * `polk_tuning_cache.txt` in the working directory otherwise.
+ */
+inline std::string getDefaultTuningCachePath() {
+  char const *path = std::getenv("POLK_TUNING_CACHE");
+  return path != nullptr ? path : "polk_tuning_cache.txt";
+}
+
+/**
+ * Tuning cache class.
+ * Stores the best tile found for each tuning key, and the tuning sessions in
+ * progress. The results are saved in a text file with one line per key,
+ * containing the key and the tile separated by a tab, the extents of the tile
+ * being separated by spaces.
+ */
+class TuningCache {
+public:
+  /**
+   * Launch performed during a tuning session.
+   */
+  struct Trial {
+    std::vector<std::size_t> mTile;
+    std::size_t mIndex;
+    bool mIsTimed;
+  };
+
+private:
+  /**
+   * Tuning session of a key.
+   */
+  struct Session {
+    std::vector<std::vector<std::size_t>> mCandidates;
+    std::size_t mLaunches = 0;
+    std::size_t mBest = 0;
+    double mBestTime = std::numeric_limits<double>::max();
+  };
+
+  std::string mPath;
+  std::map<std::string, std::vector<std::size_t>> mTiles;
+  std::map<std::string, Session> mSessions;
+  mutable std::mutex mMutex;
+
+  /**
+   * Load the results from the file, if it exists.
+   */
+  void load() {
+    std::ifstream file(mPath);
+    std::string line;
+
+    while (std::getline(file, line)) {
+      auto const separator = line.find('\t');
+      if (separator == std::string::npos) {
+        continue;
+      }
+
+      std::istringstream tileStream(line.substr(separator + 1));
+      std::vector<std::size_t> tile;
+      for (std::size_t extent; tileStream >> extent;) {
+        tile.push_back(extent);
+      }
+
+      if (!tile.empty() &&
+          std::find(tile.begin(), tile.end(), 0) == tile.end()) {
+        mTiles[line.substr(0, separator)] = tile;
+      }
+    }
+  }
+
+  /**
+   * Get a suffix unique to the process and to the call.
+   * @return Suffix made of the process ID and a random number.
+   */
+  static std::string getUniqueSuffix() {
+#ifdef _WIN32
+    auto const processId = _getpid();
+#else
+    auto const processId = getpid();
+#endif
+    std::random_device device;
+    return std::to_string(processId) + "." + std::to_string(device());
+  }
+
+  /**
+   * Save the results to the file.
+   * The file is written aside under a name unique to the process, then moved,
+   * so that it is never left truncated, even when several processes (e.g. MPI
+   * ranks) save at the same time; the last one to save wins.
+   */
+  void save() const {
+    std::string const temporaryPath = mPath + "." + getUniqueSuffix() + ".tmp";
+    {
+      std::ofstream file(temporaryPath);
+      if (!file) {
+        return;
+      }
+
+      for (auto const &[key, tile] : mTiles) {
+        file << key << '\t';
+        for (std::size_t d = 0; d < tile.size(); d++) {
+          file << (d > 0 ? " " : "") << tile[d];
+        }
+        file << '\n';
+      }
+    }
+
+    if (std::rename(temporaryPath.c_str(), mPath.c_str()) != 0) {
+      std::remove(temporaryPath.c_str());
+    }
+  }
+
+public:
+  /**
+   * Constructor.
+   * Results already saved in the file are loaded.
+   * @param path Path of the file.
+   */
+  explicit TuningCache(std::string const &path) : mPath(path) { load(); }
+
+  /**
+   * Get the tuning cache used by `polk::parallel_for`.
+   * @return Tuning cache stored at `getDefaultTuningCachePath()`.
+   */
+  static TuningCache &getInstance() {
+    static TuningCache instance(getDefaultTuningCachePath());
+    return instance;
+  }
+
+  /**
+   * Change the file of the cache.
+   * Results and sessions in progress are discarded, and the results saved in
+   * the new file are loaded.
+   * @param path Path of the file.
+   */
+  void setPath(std::string const &path) {
+    std::lock_guard lock(mMutex);
+    mPath = path;
+    mTiles.clear();
+    mSessions.clear();
+    load();
+  }
+
+  /**
+   * Getter for the path of the file.
+   * @return Path.
+   */
+  std::string getPath() const {
+    std::lock_guard lock(mMutex);
+    return mPath;
+  }
+
+  /**
+   * Find the best tile of a key.
+   * A tile that does not have the expected rank or that has a null extent,
+   * e.g. from a corrupted file, is ignored, so that the key is tuned again.
+   * @param key Tuning key.
+   * @param rank Rank of the range of the key.
+   * @return Tile if the key has been tuned.
+   */
+  std::optional<std::vector<std::size_t>> find(std::string const &key,
+                                               std::size_t const rank) const {
+    std::lock_guard lock(mMutex);
+    auto const iterator = mTiles.find(key);
+    if (iterator == mTiles.end()) {
+      return std::nullopt;
+    }
+
+    auto const &tile = iterator->second;
+    if (tile.size() != rank ||
+        std::find(tile.begin(), tile.end(), 0) != tile.end()) {
+      return std::nullopt;
+    }
+
+    return tile;
+  }
+
+  /**
+   * Store the best tile of a key, and save the results.
+   * @param key Tuning key.
+   * @param tile Tile.
+   */
+  void insert(std::string const &key, std::vector<std::size_t> const &tile) {
+    std::lock_guard lock(mMutex);
+    mTiles[key] = tile;
+    mSessions.erase(key);
+    save();
+  }
+
+  /**
+   * Start a launch of a tuning session.
+   * The session is created if it does not exist. Its first launch is an
+   * untimed warm-up, then each candidate is timed once.
+   * @param key Tuning key.
+   * @param candidates Candidate tiles, used when the session is created.
+   * Must not be empty.
+   * @return Trial to perform.
+   */
+  Trial startTrial(std::string const &key,
+                   std::vector<std::vector<std::size_t>> const &candidates) {
+    std::lock_guard lock(mMutex);
+    auto &session = mSessions[key];
+    if (session.mCandidates.empty()) {
+      session.mCandidates = candidates;
+    }
+
+    if (session.mLaunches == 0) {
+      return {session.mCandidates[0], 0, false};
+    }
+
+    std::size_t const index =
+        (session.mLaunches - 1) % session.mCandidates.size();
+    return {session.mCandidates[index], index, true};
+  }
+
+  /**
+   * End a launch of a tuning session.
+   * Once all candidates have been timed, the fastest one is stored and the
+   * results are saved.
+   * @param key Tuning key.
+   * @param trial Trial performed.
+   * @param seconds Duration of the launch.
+   */
+  void endTrial(std::string const &key, Trial const &trial,
+                double const seconds) {
+    std::lock_guard lock(mMutex);
+    auto const iterator = mSessions.find(key);
+    if (iterator == mSessions.end()) {
+      return;
+    }
+
+    auto &session = iterator->second;
+    if (trial.mIsTimed && seconds < session.mBestTime) {
+      session.mBestTime = seconds;
+      session.mBest = trial.mIndex;
+    }
+    session.mLaunches++;
+
+    if (session.mLaunches > session.mCandidates.size()) {
+      mTiles[key] = session.mCandidates[session.mBest];
+      mSessions.erase(iterator);
+      save();
+    }
+  }
+
+  /**
+   * Check if a key is being tuned.
+   * @param key Tuning key.
+   * @return True if a tuning session is in progress.
+   */
+  bool isTuning(std::string const &key) const {
+    std::lock_guard lock(mMutex);
+    return mSessions.count(key) > 0;
+  }
+};
+
+namespace impl {
+
+/**
+ * Create the tuning key of a kernel.
+ * Tabs and line breaks in the label are replaced by spaces, in order to keep
+ * the file format valid.
+ * @tparam rank Rank of the range.
+ * @param label Label of the kernel.
+ * @param spaceName Name of the execution space.
+ * @param extents Extents of the range.
+ * @return Tuning key.
+ */
+template <std::size_t rank>
+std::string getTuningKey(std::string label, std::string const &spaceName,
+                         Kokkos::Array<std::size_t, rank> const &extents) {
+  for (auto &character : label) {
+    if (character == '\t' || character == '\n' || character == '\r') {
+      character = ' ';
+    }
+  }
+
+  std::string key = label + " [" + spaceName + "] ";
+  for (std::size_t d = 0; d < rank; d++) {
+    key += (d > 0 ? "x" : "") + std::to_string(extents[d]);
+  }
+
+  return key;
+}
+
+/**
+ * Generate candidate tiles.
+ * The innermost extent and the common extent of the outer dimensions are
+ * taken among powers of two, clamped to the extents of the range. For
+ * non-host execution spaces, candidates with more than 256 points are
+ * discarded, in order to respect the limits of the devices.
+ * @tparam rank Rank of the tile.
+ * @param extents Extents of the range.
+ * @param isInnerLeft If the first dimension is the innermost one.
+ * @param isHost If the execution space is a host one.
+ * @return Candidate tiles, never empty.
+ */
+template <std::size_t rank>
+std::vector<std::vector<std::size_t>>
+getTuningCandidates(Kokkos::Array<std::size_t, rank> const &extents,
+                    bool const isInnerLeft, bool const isHost) {
+  std::vector<std::size_t> const innerSizes =
+      rank == 1 ? std::vector<std::size_t>{16, 64, 256, 1024, 4096, 16384}
+                : std::vector<std::size_t>{16, 64, 256, 1024};
+  std::vector<std::size_t> const outerSizes =
+      rank == 1 ? std::vector<std::size_t>{1}
+                : std::vector<std::size_t>{1, 4, 16, 64};
+  std::size_t const maxPoints =
+      isHost ? std::numeric_limits<std::size_t>::max() : 256;
+  std::size_t const inner = isInnerLeft ? 0 : rank - 1;
+
+  std::vector<std::vector<std::size_t>> candidates;
+  for (auto const innerSize : innerSizes) {
+    for (auto const outerSize : outerSizes) {
+      std::vector<std::size_t> tile(rank);
+      std::size_t points = 1;
+      for (std::size_t d = 0; d < rank; d++) {
+        tile[d] = std::max<std::size_t>(
+            std::min(d == inner ? innerSize : outerSize, extents[d]), 1);
+        points *= tile[d];
+      }
+
+      bool const isDuplicate =
+          std::find(candidates.begin(), candidates.end(), tile) !=
+          candidates.end();
+      if (points <= maxPoints && !isDuplicate) {
+        candidates.push_back(tile);
+      }
+    }
+  }
+
+  if (candidates.empty()) {
+    candidates.push_back(std::vector<std::size_t>(rank, 1));
+  }
+
+  return candidates;
+}
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_TUNING_HPP__
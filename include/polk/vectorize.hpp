@@ -0,0 +1,84 @@
+#ifndef __POLK_VECTORIZE_HPP__
+#define __POLK_VECTORIZE_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "work_tag.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * Kernel wrapper iterating over the innermost dimension of a range.
+ * The wrapper is launched on a range where the innermost dimension is reduced
+ * to its first index, and calls the kernel for each index of this dimension
+ * in a loop marked for SIMD vectorization.
+ * @tparam rank Rank of the range.
+ * @tparam Index Index type of the range.
+ * @tparam Functor Kernel class, called with one index per dimension.
+ * @tparam inner Innermost dimension.
+ * @tparam Tag Kokkos work tag given before the indices, `void` if none.
+ */
+template <int rank, typename Index, typename Functor, int inner,
+          typename Tag = void>
+struct VectorizedFunctor {
+  Functor mFunctor;
+  Index mBegin;
+  Index mEnd;
+
+  /**
+   * Launch the kernel on a line of the innermost dimension.
+   * @param arguments Work tag if any, then indices, the one of the innermost
+   * dimension being ignored.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments const &...arguments) const {
+    skipTag<Tag>(
+        [&](auto const &...indices) {
+          loop(std::make_index_sequence<rank>(), indices...);
+        },
+        arguments...);
+  }
+
+private:
+  /**
+   * Call the kernel for each index of the innermost dimension.
+   * @param indices Indices.
+   */
+  template <std::size_t... d, typename... Indices>
+  KOKKOS_INLINE_FUNCTION void loop(std::index_sequence<d...>,
+                                   Indices const &...indices) const {
+    static_assert(sizeof...(Indices) == rank,
+                  "Vectorized kernel must only receive indices");
+
+#if defined(_OPENMP)
+#pragma omp simd
+#elif defined(__clang__)
+#pragma clang loop vectorize(enable)
+#elif defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+    for (Index i = mBegin; i < mEnd; i++) {
+      if constexpr (std::is_void_v<Tag>) {
+        mFunctor((d == inner ? i : static_cast<Index>(indices))...);
+      } else {
+        mFunctor(Tag(), (d == inner ? i : static_cast<Index>(indices))...);
+      }
+    }
+  }
+};
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_VECTORIZE_HPP__
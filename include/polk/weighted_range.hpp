@@ -0,0 +1,258 @@
+#ifndef __POLK_WEIGHTED_RANGE_HPP__
+#define __POLK_WEIGHTED_RANGE_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "execution_policy_creator.hpp"
+#include "work_tag.hpp"
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+namespace impl {
+
+/**
+ * Default number of chunks per thread of a weighted range.
+ */
+std::size_t constexpr weightedChunksPerThread = 4;
+
+/**
+ * Split indices of varying costs into chunks of equal total cost.
+ * The first index of each chunk is found by a binary search in the exclusive
+ * prefix sum of the costs, computed on the execution space of the costs.
+ * @tparam Index Index type.
+ * @tparam CostView Kokkos view class of the costs.
+ * @param costs Non-negative cost of each index.
+ * @param count Number of chunks.
+ * @return View of the first index of each chunk, followed by the number of
+ * indices.
+ * @throw std::invalid_argument If a cost is negative.
+ */
+template <typename Index, typename CostView>
+Kokkos::View<Index *, typename CostView::memory_space>
+computeWeightedBounds(CostView const &costs, std::size_t const count) {
+  using ExecutionSpace = typename CostView::execution_space;
+  using MemorySpace = typename CostView::memory_space;
+  using Cost = std::remove_cv_t<typename CostView::value_type>;
+  using Policy = Kokkos::RangePolicy<ExecutionSpace>;
+
+  Index const size = costs.extent(0);
+
+  if constexpr (!std::is_unsigned_v<Cost>) {
+    int negativeCount = 0;
+    Kokkos::parallel_reduce(
+        "polk::WeightedRange::check", Policy(0, size),
+        KOKKOS_LAMBDA(Index const i, int &count) {
+          count += costs(i) < 0 ? 1 : 0;
+        },
+        negativeCount);
+    if (negativeCount > 0) {
+      throw std::invalid_argument("Weighted range costs must be positive");
+    }
+  }
+
+  Kokkos::View<Cost *, MemorySpace> prefix(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                         "polk::WeightedRange::prefix"),
+      size);
+  Cost total = 0;
+  Kokkos::parallel_scan(
+      "polk::WeightedRange::scan", Policy(0, size),
+      KOKKOS_LAMBDA(Index const i, Cost &partial, bool const isFinal) {
+        if (isFinal) {
+          prefix(i) = partial;
+        }
+        partial += costs(i);
+      },
+      total);
+
+  Kokkos::View<Index *, MemorySpace> bounds(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                         "polk::WeightedRange::bounds"),
+      count + 1);
+  Kokkos::parallel_for(
+      "polk::WeightedRange::bounds", Policy(0, count + 1),
+      KOKKOS_LAMBDA(std::size_t const chunk) {
+        double const target = static_cast<double>(total) *
+                              static_cast<double>(chunk) /
+                              static_cast<double>(count);
+        Index lower = 0;
+        Index upper = size;
+        while (lower < upper) {
+          Index const middle = lower + (upper - lower) / 2;
+          if (static_cast<double>(prefix(middle)) < target) {
+            lower = middle + 1;
+          } else {
+            upper = middle;
+          }
+        }
+        bounds(chunk) = chunk == count ? size : lower;
+      });
+
+  return bounds;
+}
+
+/**
+ * Kernel wrapper iterating over the indices of a chunk of a weighted range.
+ * Arguments after the chunk index, such as reduction accumulators, are given
+ * to the kernel for each index of the chunk.
+ * @tparam Index Index type of the range.
+ * @tparam MemorySpace Memory space of the chunk bounds.
+ * @tparam Functor Kernel class, called with one index.
+ * @tparam Tag Kokkos work tag given before the index, `void` if none.
+ */
+template <typename Index, typename MemorySpace, typename Functor,
+          typename Tag = void>
+struct WeightedFunctor {
+  Functor mFunctor;
+  Kokkos::View<Index *, MemorySpace> mBounds;
+
+  /**
+   * Launch the kernel on the indices of a chunk.
+   * @param arguments Work tag if any, then chunk index, followed by the other
+   * arguments of the kernel.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments &&...arguments) const {
+    skipTag<Tag>([&](auto &...untagged) { loop(untagged...); },
+                 arguments...);
+  }
+
+private:
+  /**
+   * Call the kernel for each index of a chunk.
+   * @param chunk Chunk index.
+   * @param arguments Other arguments.
+   */
+  template <typename Chunk, typename... Arguments>
+  KOKKOS_INLINE_FUNCTION void loop(Chunk const &chunk,
+                                   Arguments &...arguments) const {
+    Index const end = mBounds(chunk + 1);
+    for (Index i = mBounds(chunk); i < end; i++) {
+      if constexpr (std::is_void_v<Tag>) {
+        mFunctor(i, arguments...);
+      } else {
+        mFunctor(Tag(), i, arguments...);
+      }
+    }
+  }
+};
+
+} // namespace impl
+
+/**
+ * Weighted range class.
+ * Single-dimensional range from 0 to the extent of a view of per-index
+ * costs, split into chunks of equal total cost. It is launched through a
+ * compact range of chunks, each chunk iterating over its indices before
+ * calling the kernel, so that indices of varying cost (e.g. rows of a sparse
+ * matrix) are balanced between threads.
+ * The chunks are computed on construction, from a prefix sum of the costs on
+ * the execution space of the view.
+ * @tparam CostView Kokkos view class of the costs, of rank 1.
+ * @tparam IndexType Integral type used by Kokkos to iterate over the chunks.
+ * If not specified, the Kokkos default index type is used.
+ */
+template <typename CostView, typename IndexType = UnknownIndexType>
+struct WeightedRange : Range<1, IndexType> {
+  static_assert(Kokkos::is_view_v<CostView> && CostView::rank == 1,
+                "Costs must be a single-dimensional view");
+
+  using typename Range<1, IndexType>::Index;
+
+  /**
+   * Memory space of the chunk bounds.
+   */
+  using MemorySpace = typename CostView::memory_space;
+
+  Kokkos::View<Index *, MemorySpace> mBounds;
+
+  /**
+   * Marker to identify the class as a range.
+   */
+  using RangeType = WeightedRange<CostView, IndexType>;
+
+  /**
+   * Marker to identify the class as a weighted range.
+   */
+  using WeightedRangeType = WeightedRange<CostView, IndexType>;
+
+  WeightedRange() = delete;
+
+  /**
+   * Constructor.
+   * @param costs Non-negative cost of each index.
+   * @param chunkCount Number of chunks, limited to the number of indices. If
+   * null, a few chunks per thread of the execution space of the view are
+   * used.
+   * @throw std::invalid_argument If a cost is negative.
+   */
+  WeightedRange(CostView const &costs, std::size_t const chunkCount = 0)
+      : Range<1, IndexType>(0, costs.extent(0)) {
+    using ExecutionSpace = typename CostView::execution_space;
+
+    std::size_t const defaultCount =
+        impl::weightedChunksPerThread * ExecutionSpace().concurrency();
+    std::size_t const count = std::clamp<std::size_t>(
+        chunkCount > 0 ? chunkCount : defaultCount, 1,
+        std::max<std::size_t>(costs.extent(0), 1));
+    mBounds = impl::computeWeightedBounds<Index>(costs, count);
+  }
+
+  /**
+   * Getter for the number of chunks.
+   * @return Number of chunks.
+   */
+  std::size_t getChunkCount() const { return mBounds.extent(0) - 1; }
+
+  /**
+   * Getter for the chunk bounds.
+   * @return View of the first index of each chunk, followed by the end of the
+   * range.
+   */
+  auto getBounds() const { return mBounds; }
+
+  /**
+   * Getter for the compact range.
+   * @return Range of the chunks.
+   */
+  auto getCompactRange() const {
+    return Range<1, IndexType>(0, getChunkCount());
+  }
+
+  /**
+   * Wrap a kernel for the compact range.
+   * @tparam Tag Kokkos work tag given before the index, `void` if none.
+   * @tparam ExecutionSpace Execution space of the launch, which must be able
+   * to access the memory space of the costs, where the chunk bounds are.
+   * @tparam Functor Kernel class.
+   * @param functor Kernel.
+   * @return Kernel iterating over the indices of a chunk.
+   */
+  template <typename Tag, typename ExecutionSpace, typename Functor>
+  auto getFunctor(Functor const &functor) const {
+    static_assert(
+        Kokkos::SpaceAccessibility<ExecutionSpace, MemorySpace>::accessible,
+        "Weighted range costs must be accessible from the execution space");
+
+    return impl::WeightedFunctor<Index, MemorySpace, Functor, Tag>{functor,
+                                                                   mBounds};
+  }
+};
+
+/**
+ * Concept for the weighted range.
+ */
+template <typename T>
+concept WeightedRangeType = std::same_as<T, typename T::WeightedRangeType>;
+
+} // namespace polk
+
+#endif // ifndef __POLK_WEIGHTED_RANGE_HPP__
@@ -0,0 +1,94 @@
+#ifndef __POLK_WORK_TAG_HPP__
+#define __POLK_WORK_TAG_HPP__
+
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+/**
+ * Polk objects.
+ */
+namespace polk {
+
+/**
+ * Work tag class.
+ * Forwarded to the policy as a Kokkos work tag, so that the kernel is called
+ * with an instance of the tag before the indices. A functor with one
+ * operator per tag can then run several phases from the same object.
+ * @tparam Tag Tag class, which must be empty.
+ */
+template <typename Tag> struct WorkTag {
+  static_assert(std::is_empty_v<Tag>, "Work tag must be an empty class");
+
+public:
+  /**
+   * Marker to identify the class as a work tag.
+   */
+  using WorkTagType = WorkTag<Tag>;
+
+  /**
+   * Corresponding Kokkos work tag.
+   */
+  using KokkosWorkTag = Tag;
+};
+
+/**
+ * Concept for the work tag.
+ */
+template <typename T>
+concept WorkTagType = std::same_as<T, typename T::WorkTagType>;
+
+/**
+ * Default work tag.
+ */
+struct UnknownWorkTag {};
+
+namespace impl {
+
+/**
+ * Kernel wrapper calling the kernel with a work tag before its arguments.
+ * Used when the kernel is launched through a policy that does not carry the
+ * work tag.
+ * @tparam Tag Tag class.
+ * @tparam Functor Kernel class.
+ */
+template <typename Tag, typename Functor> struct TaggedFunctor {
+  Functor mFunctor;
+
+  /**
+   * Call the kernel.
+   * @param arguments Arguments of the kernel, after the tag.
+   */
+  template <typename... Arguments>
+  KOKKOS_FUNCTION void operator()(Arguments &&...arguments) const {
+    mFunctor(Tag(), static_cast<Arguments &&>(arguments)...);
+  }
+};
+
+/**
+ * Call a function with the arguments of a kernel, without the work tag.
+ * Used by kernel wrappers that remap the indices before giving the work tag
+ * back to the kernel.
+ * @tparam Tag Kokkos work tag given before the other arguments, `void` if
+ * none.
+ * @param function Function, called with the arguments after the tag.
+ * @param first Work tag, or first argument if there is no work tag.
+ * @param arguments Other arguments.
+ */
+template <typename Tag, typename Function, typename First,
+          typename... Arguments>
+KOKKOS_INLINE_FUNCTION void skipTag(Function const &function, First &&first,
+                                    Arguments &&...arguments) {
+  if constexpr (std::is_void_v<Tag>) {
+    function(static_cast<First &&>(first),
+             static_cast<Arguments &&>(arguments)...);
+  } else {
+    function(static_cast<Arguments &&>(arguments)...);
+  }
+}
+
+} // namespace impl
+
+} // namespace polk
+
+#endif // ifndef __POLK_WORK_TAG_HPP__
@@ -1,3 +1,5 @@
+#include <stdexcept>
+
 #include <Kokkos_Core.hpp>
 #include <gtest/gtest.h>
 
@@ -38,6 +40,40 @@ TEST(test_range, test_create_array_move) {
   ASSERT_EQ(myRange.getEnd()[1], 1);
 }
 
+TEST(test_range, test_create_index_type) {
+  auto myRange = polk::Range<2, std::int32_t>({-1, 0}, {1, 1});
+
+  static_assert(myRange.getRank() == 2);
+  static_assert(myRange.hasIndexType());
+  static_assert(std::is_same_v<decltype(myRange)::Index, std::int32_t>);
+  static_assert(!polk::Range<2>::hasIndexType());
+
+  ASSERT_EQ(myRange.getBegin()[0], -1);
+  ASSERT_EQ(myRange.getBegin()[1], 0);
+  ASSERT_EQ(myRange.getEnd()[0], 1);
+  ASSERT_EQ(myRange.getEnd()[1], 1);
+}
+
+TEST(test_range, test_create_strided) {
+  auto myRange = polk::StridedRange<2>({1, 0}, {10, 9}, {2, 3});
+
+  static_assert(myRange.getRank() == 2);
+  static_assert(polk::RangeType<decltype(myRange)>);
+  static_assert(polk::StridedRangeType<decltype(myRange)>);
+  static_assert(!polk::StridedRangeType<polk::Range<2>>);
+
+  auto compactRange = myRange.getCompactRange();
+
+  ASSERT_EQ(myRange.getStride()[0], 2);
+  ASSERT_EQ(myRange.getStride()[1], 3);
+  ASSERT_EQ(compactRange.getBegin()[0], 0);
+  ASSERT_EQ(compactRange.getBegin()[1], 0);
+  ASSERT_EQ(compactRange.getEnd()[0], 5);
+  ASSERT_EQ(compactRange.getEnd()[1], 3);
+  ASSERT_EQ(polk::StridedRange(4, 2, 1).getCompactRange().getEnd()[0], 0);
+  ASSERT_THROW(polk::StridedRange(0, 10, 0), std::invalid_argument);
+}
+
 TEST(test_tiling, test_create) {
   auto myTiling = polk::Tiling<2>({10, 10});
 
@@ -47,6 +83,43 @@ TEST(test_tiling, test_create) {
   ASSERT_EQ(myTiling.getTile()[1], 10);
 }
 
+TEST(test_schedule, test_create) {
+  [[maybe_unused]] auto mySchedule = polk::Schedule<Kokkos::Dynamic>();
+
+  static_assert(std::is_same_v<decltype(mySchedule)::KokkosSchedule,
+                               Kokkos::Schedule<Kokkos::Dynamic>>);
+}
+
+TEST(test_iterate, test_create) {
+  [[maybe_unused]] auto myIterate =
+      polk::Iterate<Kokkos::Iterate::Left, Kokkos::Iterate::Right>();
+
+  static_assert(myIterate.getRank() == polk::unknownRank);
+  static_assert(
+      std::is_same_v<decltype(myIterate)::KokkosRank<2>,
+                     Kokkos::Rank<2, Kokkos::Iterate::Left,
+                                  Kokkos::Iterate::Right>>);
+}
+
+TEST(test_iterate, test_create_like_view) {
+  Kokkos::View<int **, Kokkos::LayoutLeft> dataLeft("data left", 10, 10);
+  Kokkos::View<int ***, Kokkos::LayoutRight> dataRight("data right", 10, 10,
+                                                       10);
+  [[maybe_unused]] auto myIterateLeft = polk::iterateLike(dataLeft);
+  [[maybe_unused]] auto myIterateRight = polk::iterateLike(dataRight);
+
+  static_assert(myIterateLeft.getRank() == 2);
+  static_assert(
+      std::is_same_v<decltype(myIterateLeft),
+                     polk::Iterate<Kokkos::Iterate::Left,
+                                   Kokkos::Iterate::Left, 2>>);
+  static_assert(myIterateRight.getRank() == 3);
+  static_assert(
+      std::is_same_v<decltype(myIterateRight),
+                     polk::Iterate<Kokkos::Iterate::Right,
+                                   Kokkos::Iterate::Right, 3>>);
+}
+
 TEST(test_execution_policy_creator, test_default) {
   [[maybe_unused]] auto myExecutionParameters = polk::ExecutionParameters();
 
@@ -54,6 +127,8 @@ TEST(test_execution_policy_creator, test_default) {
   static_assert(!myExecutionParameters.hasRange());
   static_assert(!myExecutionParameters.hasTiling());
   static_assert(!myExecutionParameters.hasExecutionSpace());
+  static_assert(!myExecutionParameters.hasSchedule());
+  static_assert(!myExecutionParameters.hasIterate());
 }
 
 TEST(test_execution_policy_creator, test_with_range) {
@@ -99,6 +174,60 @@ TEST(test_execution_policy_creator, test_with_space) {
                      Kokkos::DefaultExecutionSpace>);
 }
 
+TEST(test_execution_policy_creator, test_with_schedule) {
+  auto mySchedule = polk::Schedule<Kokkos::Dynamic>();
+  auto myExecutionParameters = polk::ExecutionParameters().with(mySchedule);
+
+  static_assert(!myExecutionParameters.hasRank());
+  static_assert(!myExecutionParameters.hasRange());
+  static_assert(!myExecutionParameters.hasTiling());
+  static_assert(!myExecutionParameters.hasExecutionSpace());
+  static_assert(myExecutionParameters.hasSchedule());
+
+  static_assert(std::is_same_v<decltype(myExecutionParameters.getSchedule()),
+                               decltype(mySchedule)>);
+}
+
+TEST(test_execution_policy_creator, test_with_iterate) {
+  auto myIterate = polk::Iterate<Kokkos::Iterate::Left>();
+  auto myExecutionParameters = polk::ExecutionParameters().with(myIterate);
+
+  static_assert(!myExecutionParameters.hasRank());
+  static_assert(!myExecutionParameters.hasRange());
+  static_assert(myExecutionParameters.hasIterate());
+
+  static_assert(std::is_same_v<decltype(myExecutionParameters.getIterate()),
+                               decltype(myIterate)>);
+}
+
+TEST(test_execution_policy_creator, test_with_iterate_like_view) {
+  Kokkos::View<int **, Kokkos::LayoutLeft> data("data", 10, 10);
+  auto myExecutionParameters =
+      polk::ExecutionParameters().with(polk::iterateLike(data));
+
+  static_assert(myExecutionParameters.hasRank());
+  static_assert(!myExecutionParameters.hasRange());
+  static_assert(myExecutionParameters.hasIterate());
+
+  static_assert(myExecutionParameters.getRank() == 2);
+}
+
+TEST(test_execution_policy_creator, test_replace) {
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {10, 10}))
+          .with(polk::Tiling<2>({2, 2}))
+          .replace(polk::Range<2>({5, 5}, {20, 20}))
+          .replace(polk::Tiling<2>({4, 4}))
+          .replace(Kokkos::DefaultExecutionSpace());
+
+  static_assert(myExecutionParameters.hasExecutionSpace());
+
+  ASSERT_EQ(myExecutionParameters.getRange().getBegin()[0], 5);
+  ASSERT_EQ(myExecutionParameters.getRange().getEnd()[1], 20);
+  ASSERT_EQ(myExecutionParameters.getTiling().getTile()[0], 4);
+}
+
 TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy) {
   auto myRange = polk::Range<2>({0, 0}, {1, 1});
   auto myExecutionParameters = polk::ExecutionParameters().with(myRange);
@@ -113,6 +242,19 @@ TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy) {
   ASSERT_EQ(policy.m_upper[1], 1);
 }
 
+TEST(test_execution_policy_creator, test_get_policy_strided) {
+  auto myExecutionParameters = polk::ExecutionParameters().with(
+      polk::StridedRange<2>({1, 0}, {10, 9}, {2, 3}));
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(policy.rank == 2);
+
+  ASSERT_EQ(policy.m_lower[0], 0);
+  ASSERT_EQ(policy.m_lower[1], 0);
+  ASSERT_EQ(policy.m_upper[0], 5);
+  ASSERT_EQ(policy.m_upper[1], 3);
+}
+
 TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy_tiling) {
   auto myRange = polk::Range<2>({0, 0}, {100, 100});
   auto myTiling = polk::Tiling<2>({10, 10});
@@ -263,6 +405,127 @@ TEST(test_execution_policy_creator, test_get_policy_rangepolicy_tiling_space) {
   ASSERT_EQ(policy.chunk_size(), 10);
 }
 
+TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy_schedule) {
+  auto myRange = polk::Range<2>({0, 0}, {100, 100});
+  auto myTiling = polk::Tiling<2>({10, 10});
+  auto myExecutionParameters = polk::ExecutionParameters()
+                                   .with(myRange)
+                                   .with(myTiling)
+                                   .with(polk::Schedule<Kokkos::Dynamic>());
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(policy.rank == 2);
+  static_assert(std::is_same_v<typename decltype(policy)::schedule_type,
+                               Kokkos::Schedule<Kokkos::Dynamic>>);
+
+  ASSERT_EQ(policy.m_upper[0], 100);
+  ASSERT_EQ(policy.m_upper[1], 100);
+  ASSERT_EQ(policy.m_tile[0], 10);
+  ASSERT_EQ(policy.m_tile[1], 10);
+}
+
+TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy_iterate) {
+  auto myRange = polk::Range<2>({0, 0}, {100, 100});
+  auto myTiling = polk::Tiling<2>({10, 10});
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Iterate<Kokkos::Iterate::Left, Kokkos::Iterate::Right>())
+          .with(myRange)
+          .with(myTiling);
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(policy.rank == 2);
+  static_assert(
+      std::is_same_v<decltype(policy),
+                     Kokkos::MDRangePolicy<Kokkos::Rank<
+                         2, Kokkos::Iterate::Left, Kokkos::Iterate::Right>>>);
+
+  ASSERT_EQ(policy.m_upper[0], 100);
+  ASSERT_EQ(policy.m_upper[1], 100);
+  ASSERT_EQ(policy.m_tile[0], 10);
+  ASSERT_EQ(policy.m_tile[1], 10);
+}
+
+TEST(test_execution_policy_creator,
+     test_get_policy_mdrangepolicy_iterate_like_view) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft> data("data", 10, 10, 10);
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<3>({0, 0, 0}, {10, 10, 10}))
+          .with(polk::iterateLike(data));
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(
+      std::is_same_v<decltype(policy),
+                     Kokkos::MDRangePolicy<Kokkos::Rank<
+                         3, Kokkos::Iterate::Left, Kokkos::Iterate::Left>>>);
+}
+
+TEST(test_execution_policy_creator, test_get_policy_rangepolicy_iterate) {
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range(0, 100))
+          .with(polk::Iterate<Kokkos::Iterate::Left>());
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(std::is_same_v<decltype(policy), Kokkos::RangePolicy<>>);
+
+  ASSERT_EQ(policy.begin(), 0);
+  ASSERT_EQ(policy.end(), 100);
+}
+
+TEST(test_execution_policy_creator, test_get_policy_rangepolicy_schedule) {
+  auto myRange = polk::Range(0, 100);
+  auto myTiling = polk::Tiling(10);
+  auto myExecutionSpace = Kokkos::DefaultExecutionSpace();
+  auto myExecutionParameters = polk::ExecutionParameters()
+                                   .with(polk::Schedule<Kokkos::Dynamic>())
+                                   .with(myRange)
+                                   .with(myTiling)
+                                   .with(myExecutionSpace);
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(std::is_same_v<typename decltype(policy)::schedule_type,
+                               Kokkos::Schedule<Kokkos::Dynamic>>);
+
+  ASSERT_EQ(policy.begin(), 0);
+  ASSERT_EQ(policy.end(), 100);
+  ASSERT_EQ(policy.chunk_size(), 10);
+}
+
+TEST(test_execution_policy_creator, test_get_policy_mdrangepolicy_index_type) {
+  auto myRange = polk::Range<2, std::int32_t>({0, 0}, {100, 100});
+  auto myExecutionParameters = polk::ExecutionParameters().with(myRange);
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(policy.rank == 2);
+  static_assert(
+      std::is_same_v<decltype(policy),
+                     Kokkos::MDRangePolicy<Kokkos::Rank<2>,
+                                           Kokkos::IndexType<std::int32_t>>>);
+
+  ASSERT_EQ(policy.m_upper[0], 100);
+  ASSERT_EQ(policy.m_upper[1], 100);
+}
+
+TEST(test_execution_policy_creator, test_get_policy_rangepolicy_index_type) {
+  auto myRange = polk::Range<1, std::int32_t>(0, 100);
+  auto myExecutionParameters = polk::ExecutionParameters().with(myRange);
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(
+      std::is_same_v<decltype(policy),
+                     Kokkos::RangePolicy<Kokkos::IndexType<std::int32_t>>>);
+
+  ASSERT_EQ(policy.begin(), 0);
+  ASSERT_EQ(policy.end(), 100);
+}
+
 struct DummyKernel2D {
   Kokkos::View<int **> mData;
 
@@ -312,3 +575,25 @@ TEST(test_execution_policy_creator_integration, test_mdrangepolicy_space_tmp) {
 
   ASSERT_EQ(dataMirror(50, 50), 100);
 }
+
+TEST(test_execution_policy_creator_integration, test_strided) {
+  int constexpr size = 10;
+  Kokkos::View<int **> data("data", size, size);
+  auto myExecutionParameters = polk::ExecutionParameters().with(
+      polk::StridedRange<2>({1, 0}, {size, size}, {2, 3}));
+
+  Kokkos::parallel_for(
+      "strided", myExecutionParameters.getPolicy(),
+      myExecutionParameters.getFunctor(
+          KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+            data(i, j) = 1;
+          }));
+
+  auto dataMirror =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(dataMirror(i, j), i % 2 == 1 && j % 3 == 0 ? 1 : 0);
+    }
+  }
+}
@@ -0,0 +1,94 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/auto_tiling.hpp"
+#include "polk/execution_policy_creator.hpp"
+
+TEST(test_auto_tiling, test_parse_cache_size) {
+  ASSERT_EQ(polk::impl::parseCacheSize("48K"), 48 * 1024);
+  ASSERT_EQ(polk::impl::parseCacheSize("2M"), 2 * 1024 * 1024);
+  ASSERT_EQ(polk::impl::parseCacheSize("512"), 512);
+  ASSERT_EQ(polk::impl::parseCacheSize("unknown"), 0);
+}
+
+TEST(test_auto_tiling, test_host_cache_sizes) {
+  auto const &cacheSizes = polk::getHostCacheSizes();
+
+  ASSERT_GT(cacheSizes.mL1, 0);
+  ASSERT_GT(cacheSizes.mL2, 0);
+}
+
+TEST(test_auto_tiling, test_compute_auto_tile) {
+  auto tile = polk::impl::computeAutoTile<3>(
+      {512, 512, 512}, 16, false, 1, polk::CacheSizes{32 * 1024, 1024 * 1024});
+
+  ASSERT_EQ(tile[0], 8);
+  ASSERT_EQ(tile[1], 8);
+  ASSERT_EQ(tile[2], 512);
+}
+
+TEST(test_auto_tiling, test_compute_auto_tile_left) {
+  auto tile = polk::impl::computeAutoTile<3>(
+      {512, 512, 512}, 16, true, 1, polk::CacheSizes{32 * 1024, 1024 * 1024});
+
+  ASSERT_EQ(tile[0], 512);
+  ASSERT_EQ(tile[1], 8);
+  ASSERT_EQ(tile[2], 8);
+}
+
+TEST(test_auto_tiling, test_compute_auto_tile_concurrency) {
+  auto tile = polk::impl::computeAutoTile<2>(
+      {16, 16}, 8, false, 4, polk::CacheSizes{32 * 1024, 1024 * 1024});
+
+  ASSERT_EQ(tile[0], 2);
+  ASSERT_EQ(tile[1], 16);
+}
+
+TEST(test_auto_tiling, test_compute_auto_tile_chunk) {
+  auto tile = polk::impl::computeAutoTile<1>(
+      {1000000}, 8, false, 1, polk::CacheSizes{32 * 1024, 1024 * 1024});
+
+  ASSERT_EQ(tile[0], 4096);
+}
+
+TEST(test_execution_policy_creator, test_with_auto_tiling) {
+  auto myExecutionParameters =
+      polk::ExecutionParameters().with(polk::AutoTiling(16));
+
+  static_assert(!myExecutionParameters.hasRank());
+  static_assert(myExecutionParameters.hasTiling());
+
+  ASSERT_EQ(myExecutionParameters.getTiling().getBytesPerIteration(), 16);
+}
+
+TEST(test_execution_policy_creator,
+     test_get_policy_mdrangepolicy_auto_tiling_host) {
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<3>({0, 0, 0}, {64, 64, 64}))
+          .with(polk::AutoTiling(16))
+          .with(Kokkos::DefaultHostExecutionSpace());
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+  static_assert(policy.rank == 3);
+
+  for (int d = 0; d < 3; d++) {
+    ASSERT_GE(policy.m_tile[d], 1);
+    ASSERT_LE(policy.m_tile[d], 64);
+  }
+}
+
+TEST(test_execution_policy_creator,
+     test_get_policy_rangepolicy_auto_tiling_host) {
+  auto myExecutionParameters = polk::ExecutionParameters()
+                                   .with(polk::Range(0, 100000))
+                                   .with(polk::AutoTiling())
+                                   .with(Kokkos::DefaultHostExecutionSpace());
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(Kokkos::is_execution_policy<decltype(policy)>::value);
+
+  ASSERT_GE(policy.chunk_size(), 1);
+  ASSERT_LE(policy.chunk_size(), 100000);
+}
@@ -0,0 +1,47 @@
+#include <cstddef>
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/dispatch.hpp"
+#include "polk/execution_policy_creator.hpp"
+
+TEST(test_dispatch, test_selector) {
+  auto selector = polk::SpaceSelector(1, Kokkos::DefaultHostExecutionSpace(),
+                                      Kokkos::DefaultExecutionSpace());
+
+  ASSERT_EQ(selector.getIndex(), 1);
+  ASSERT_EQ(selector.getSize(), 2);
+}
+
+TEST(test_dispatch, test_selector_out_of_range) {
+  ASSERT_THROW(polk::SpaceSelector(1, Kokkos::DefaultExecutionSpace()),
+               std::out_of_range);
+}
+
+TEST(test_dispatch, test_host_or_device) {
+  ASSERT_EQ(polk::hostOrDevice(false).getIndex(), 0);
+  ASSERT_EQ(polk::hostOrDevice(true).getIndex(), 1);
+}
+
+TEST(test_dispatch, test_dispatch) {
+  int constexpr size = 100;
+
+  for (std::size_t const index : {0, 1}) {
+    Kokkos::View<int *> data("data", size);
+
+    polk::dispatch(
+        "fill",
+        polk::SpaceSelector(index, Kokkos::DefaultExecutionSpace(),
+                            Kokkos::DefaultExecutionSpace()),
+        polk::ExecutionParameters().with(polk::Range<1>({0}, {size})),
+        KOKKOS_LAMBDA(int const i) { data(i) = i; }, polk::Fence::after);
+
+    auto dataHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+    for (int i = 0; i < size; i++) {
+      ASSERT_EQ(dataHost(i), i);
+    }
+  }
+}
@@ -0,0 +1,112 @@
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/dynamic_range.hpp"
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+
+TEST(test_dynamic_range, test_create) {
+  polk::DynamicRange const range({0, 1}, {10, 20});
+
+  ASSERT_EQ(range.getRank(), 2);
+  ASSERT_EQ(polk::DynamicRange<>::getMaxRank(), 3);
+
+  auto staticRange = range.getRange<2>();
+
+  ASSERT_EQ(staticRange.getBegin()[1], 1);
+  ASSERT_EQ(staticRange.getEnd()[1], 20);
+  ASSERT_THROW(range.getRange<3>(), std::invalid_argument);
+
+  polk::DynamicTiling const tiling({4, 8});
+
+  ASSERT_EQ(tiling.getRank(), 2);
+  ASSERT_EQ(tiling.getTiling<2>().getTile()[1], 8);
+  ASSERT_THROW(tiling.getTiling<1>(), std::invalid_argument);
+}
+
+TEST(test_dynamic_range, test_invalid) {
+  ASSERT_THROW(polk::DynamicRange({0, 0}, {10}), std::invalid_argument);
+  ASSERT_THROW(polk::DynamicRange({}, {}), std::invalid_argument);
+  ASSERT_THROW(polk::DynamicRange<2>({0, 0, 0}, {1, 1, 1}),
+               std::invalid_argument);
+  ASSERT_THROW(polk::DynamicTiling<2>({1, 1, 1}), std::invalid_argument);
+}
+
+TEST(test_dynamic_range, test_dispatch_rank) {
+  int constexpr size = 10;
+  Kokkos::View<int *> data1("data1", size);
+  Kokkos::View<int **> data2("data2", size, size);
+
+  for (int rank = 1; rank <= 2; rank++) {
+    std::vector<int> const begin(rank, 0);
+    std::vector<int> const end(rank, size);
+    int calledRank = 0;
+
+    polk::dispatch_rank(
+        polk::ExecutionParameters(),
+        polk::DynamicRange<2, int>(begin, end),
+        [&](auto const &parameters) {
+          calledRank = parameters.getRank();
+
+          if constexpr (parameters.getRank() == 1) {
+            polk::parallel_for(
+                "fill1", parameters,
+                KOKKOS_LAMBDA(int const i) { data1(i) = i; });
+          } else {
+            polk::parallel_for(
+                "fill2", parameters,
+                KOKKOS_LAMBDA(int const i, int const j) {
+                  data2(i, j) = i + j;
+                });
+          }
+        });
+
+    ASSERT_EQ(calledRank, rank);
+  }
+
+  auto data1Host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data1);
+  auto data2Host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data2);
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(data1Host(i), i);
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(data2Host(i, j), i + j);
+    }
+  }
+}
+
+TEST(test_dynamic_range, test_dispatch_rank_tiling) {
+  int constexpr size = 10;
+  Kokkos::View<int **> data("data", size, size);
+  bool isTiled = false;
+
+  polk::dispatch_rank(polk::ExecutionParameters(),
+                      polk::DynamicRange({0, 0}, {size, size}),
+                      polk::DynamicTiling({4, 4}), [&](auto const &parameters) {
+                        isTiled = parameters.hasTiling();
+
+                        if constexpr (parameters.getRank() == 2) {
+                          polk::parallel_for(
+                              "fill", parameters,
+                              KOKKOS_LAMBDA(std::size_t const i,
+                                            std::size_t const j) {
+                                data(i, j) = i + j;
+                              });
+                        }
+                      });
+
+  ASSERT_TRUE(isTiled);
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(3, 4), 7);
+
+  ASSERT_THROW(polk::dispatch_rank(polk::ExecutionParameters(),
+                                   polk::DynamicRange({0, 0}, {size, size}),
+                                   polk::DynamicTiling({4}),
+                                   [](auto const &) {}),
+               std::invalid_argument);
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/first_touch.hpp"
+
+namespace {
+
+struct Compute {};
+
+/**
+ * Value written before the first touch, distinct from the value-initialized
+ * element written by it.
+ */
+int constexpr sentinel = -7;
+
+} // namespace
+
+TEST(test_first_touch, test_first_touch) {
+  int constexpr size = 10;
+  Kokkos::View<double **> a(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "a"), size, size);
+  Kokkos::View<int **> b(Kokkos::view_alloc(Kokkos::WithoutInitializing, "b"),
+                         size, size);
+  Kokkos::View<double **> c(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "c"), size, size);
+
+  // filling the views with the sentinel already touches their pages, and
+  // page placement cannot be observed here anyway: only the written values
+  // and the elements covered by the range are checked
+  Kokkos::deep_copy(a, sentinel);
+  Kokkos::deep_copy(b, sentinel);
+  Kokkos::deep_copy(c, sentinel);
+  polk::first_touch(polk::ExecutionParameters()
+                        .with(polk::Range<2>({1, 2}, {size, size}))
+                        .with(polk::Tiling<2>({3, 4})),
+                    a, b, c);
+
+  auto aHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto bHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  auto cHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      bool const isTouched = i >= 1 && j >= 2;
+      ASSERT_EQ(aHost(i, j), isTouched ? 0. : sentinel);
+      ASSERT_EQ(bHost(i, j), isTouched ? 0 : sentinel);
+      ASSERT_EQ(cHost(i, j), isTouched ? 0. : sentinel);
+    }
+  }
+}
+
+TEST(test_first_touch, test_first_touch_work_tag) {
+  int constexpr size = 10;
+  Kokkos::View<double *> a("a", size);
+
+  Kokkos::deep_copy(a, sentinel);
+  polk::first_touch(polk::ExecutionParameters()
+                        .with(polk::Range(0, size))
+                        .with(polk::WorkTag<Compute>()),
+                    a);
+
+  auto aHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(aHost(i), 0.);
+  }
+}
@@ -0,0 +1,87 @@
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/fusion.hpp"
+
+TEST(test_fusion, test_fused_functor) {
+  std::vector<int> calls;
+  polk::impl::FusedFunctor const fusedFunctor(
+      [&](int const i) { calls.push_back(i); },
+      [&](int const i) { calls.push_back(10 * i); },
+      [&](int const i) { calls.push_back(100 * i); });
+
+  fusedFunctor(2);
+
+  ASSERT_EQ(calls, (std::vector<int>{2, 20, 200}));
+}
+
+TEST(test_fusion, test_fuse_per_index) {
+  int constexpr size = 100;
+  Kokkos::View<int *> a("a", size);
+  Kokkos::View<int *> b("b", size);
+  Kokkos::View<int *> c("c", size);
+
+  polk::fuse(
+      "step", polk::ExecutionParameters().with(polk::Range(0, size)),
+      KOKKOS_LAMBDA(std::size_t const i) { a(i) = i; },
+      KOKKOS_LAMBDA(std::size_t const i) { b(i) = 2 * a(i); },
+      KOKKOS_LAMBDA(std::size_t const i) { c(i) = a(i) + b(i); });
+
+  auto cHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(cHost(i), 3 * i);
+  }
+}
+
+TEST(test_fusion, test_fuse_per_tile) {
+  int constexpr size = 30;
+  int constexpr tileSize = 8;
+  Kokkos::View<int **> a("a", size, size);
+  Kokkos::View<int **> b("b", size, size);
+
+  polk::fuse<polk::Fusion::perTile>(
+      "step",
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {size, size}))
+          .with(polk::Tiling<2>({tileSize, tileSize})),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        a(i, j) = i + j;
+      },
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        // first point of the tile, written by the previous kernel
+        b(i, j) = a(i, j) + a(i - i % tileSize, j - j % tileSize);
+      });
+
+  auto bHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(bHost(i, j), i + j + i - i % tileSize + j - j % tileSize);
+    }
+  }
+}
+
+TEST(test_fusion, test_fuse_per_tile_tile_order) {
+  int constexpr size = 20;
+  Kokkos::View<int **> a("a", size, size);
+
+  polk::fuse<polk::Fusion::perTile>(
+      "step",
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {size, size}))
+          .with(polk::Tiling<2>({6, 4}))
+          .with(polk::TileOrder<polk::Hilbert>()),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        a(i, j) = i * size + j;
+      },
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) { a(i, j)++; });
+
+  auto aHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(aHost(i, j), i * size + j + 1);
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include <stdexcept>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/graph.hpp"
+
+TEST(test_graph, test_access) {
+  Kokkos::View<int *> a("a", 10);
+  Kokkos::View<int *> b("b", 10);
+  Kokkos::View<int *> c("c", 10);
+
+  auto const writeA = polk::Access().writes(a);
+  auto const readA = polk::Access().reads(a).writes(b);
+  auto const readAOnly = polk::Access().reads(a).writes(c);
+  auto const writeC = polk::Access().writes(c);
+
+  ASSERT_TRUE(readA.dependsOn(writeA));
+  ASSERT_TRUE(writeA.dependsOn(readA));
+  ASSERT_FALSE(readAOnly.dependsOn(readA));
+  ASSERT_TRUE(writeC.dependsOn(readAOnly));
+  ASSERT_FALSE(writeC.dependsOn(writeA));
+}
+
+TEST(test_graph, test_invalid) {
+  ASSERT_THROW(polk::LaunchGraph<>(0), std::invalid_argument);
+}
+
+TEST(test_graph, test_lanes) {
+  int constexpr size = 10;
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> a("a", size);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> b("b", size);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> c("c", size);
+  auto const parameters =
+      polk::ExecutionParameters().with(polk::Range(0, size));
+  auto const kernel = KOKKOS_LAMBDA(std::size_t const) {};
+
+  polk::LaunchGraph<Kokkos::DefaultHostExecutionSpace> graph(2);
+  auto const fillA =
+      graph.add("fill a", parameters, kernel, polk::Access().writes(a));
+  auto const fillB =
+      graph.add("fill b", parameters, kernel, polk::Access().writes(b));
+  auto const sum = graph.add("sum", parameters, kernel,
+                             polk::Access().reads(a, b).writes(c));
+
+  ASSERT_EQ(graph.getSize(), 3);
+  ASSERT_EQ(graph.getLaneCount(), 2);
+  ASSERT_NE(graph.getLane(fillA), graph.getLane(fillB));
+  ASSERT_EQ(graph.getLane(sum), graph.getLane(fillB));
+  ASSERT_TRUE(graph.getDependencies(fillB).empty());
+  ASSERT_EQ(graph.getDependencies(sum),
+            (std::vector<std::size_t>{fillA, fillB}));
+}
+
+TEST(test_graph, test_run) {
+  int constexpr size = 100;
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> a("a", size);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> b("b", size);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> c("c", size);
+  auto const parameters =
+      polk::ExecutionParameters().with(polk::Range(0, size));
+
+  polk::LaunchGraph<Kokkos::DefaultHostExecutionSpace> graph(3);
+  graph.add(
+      "fill a", parameters, KOKKOS_LAMBDA(std::size_t const i) { a(i) = i; },
+      polk::Access().writes(a));
+  graph.add(
+      "fill b", parameters,
+      KOKKOS_LAMBDA(std::size_t const i) { b(i) = 2 * i; },
+      polk::Access().writes(b));
+  graph.add(
+      "sum", parameters,
+      KOKKOS_LAMBDA(std::size_t const i) { c(i) = a(i) + b(i); },
+      polk::Access().reads(a, b).writes(c));
+  graph.add(
+      "scale a", parameters, KOKKOS_LAMBDA(std::size_t const i) { a(i) *= 10; },
+      polk::Access().writes(a));
+
+  for (int run = 0; run < 2; run++) {
+    graph.run();
+  }
+
+  auto aHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto cHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(aHost(i), 10 * i);
+    ASSERT_EQ(cHost(i), 3 * i);
+  }
+}
+
+#ifdef KOKKOS_ENABLE_THREADS
+TEST(test_graph, test_run_threads) {
+  int constexpr size = 100;
+  Kokkos::View<int *, Kokkos::HostSpace> a("a", size);
+  Kokkos::View<int *, Kokkos::HostSpace> b("b", size);
+  auto const parameters =
+      polk::ExecutionParameters().with(polk::Range(0, size));
+
+  polk::LaunchGraph<Kokkos::Threads> graph(2);
+  graph.add(
+      "fill a", parameters, KOKKOS_LAMBDA(std::size_t const i) { a(i) = i; },
+      polk::Access().writes(a));
+  graph.add(
+      "fill b", parameters,
+      KOKKOS_LAMBDA(std::size_t const i) { b(i) = 2 * i; },
+      polk::Access().writes(b));
+  graph.add(
+      "sum", parameters,
+      KOKKOS_LAMBDA(std::size_t const i) { a(i) += b(i); },
+      polk::Access().reads(b).writes(a));
+  graph.run();
+
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(a(i), 3 * i);
+  }
+}
+#endif
@@ -0,0 +1,112 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/halo.hpp"
+#include "polk/parallel.hpp"
+
+TEST(test_halo, test_decompose) {
+  auto decomposition = polk::decomposeHalo(
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 10}, {20, 40}))
+          .with(polk::Tiling<2>({4, 8})),
+      {2, 3});
+  auto const &interior = decomposition.getInterior();
+  auto const &boundaries = decomposition.getBoundaries();
+
+  ASSERT_EQ(interior.getRange().getBegin()[0], 2);
+  ASSERT_EQ(interior.getRange().getEnd()[0], 18);
+  ASSERT_EQ(interior.getRange().getBegin()[1], 13);
+  ASSERT_EQ(interior.getRange().getEnd()[1], 37);
+  ASSERT_EQ(interior.getTiling().getTile()[1], 8);
+  ASSERT_EQ(boundaries.size(), 4);
+
+  // lower slab of the first dimension spans the whole second dimension
+  ASSERT_EQ(boundaries[0].getRange().getBegin()[0], 0);
+  ASSERT_EQ(boundaries[0].getRange().getEnd()[0], 2);
+  ASSERT_EQ(boundaries[0].getRange().getBegin()[1], 10);
+  ASSERT_EQ(boundaries[0].getRange().getEnd()[1], 40);
+
+  // upper slab of the second dimension spans the interior of the first one
+  ASSERT_EQ(boundaries[3].getRange().getBegin()[0], 2);
+  ASSERT_EQ(boundaries[3].getRange().getEnd()[0], 18);
+  ASSERT_EQ(boundaries[3].getRange().getBegin()[1], 37);
+  ASSERT_EQ(boundaries[3].getRange().getEnd()[1], 40);
+}
+
+TEST(test_halo, test_decompose_clamped) {
+  auto decomposition = polk::decomposeHalo(
+      polk::ExecutionParameters().with(polk::Range(0, 5)), {4});
+  auto const &boundaries = decomposition.getBoundaries();
+
+  ASSERT_EQ(decomposition.getInterior().getRange().getBegin()[0], 2);
+  ASSERT_EQ(decomposition.getInterior().getRange().getEnd()[0], 3);
+  ASSERT_EQ(boundaries[0].getRange().getEnd()[0], 2);
+  ASSERT_EQ(boundaries[1].getRange().getBegin()[0], 3);
+  ASSERT_EQ(boundaries[1].getRange().getEnd()[0], 5);
+}
+
+TEST(test_halo, test_cover) {
+  int constexpr size = 12;
+  Kokkos::View<int ***> counts("counts", size, size, size);
+  auto decomposition = polk::decomposeHalo(
+      polk::ExecutionParameters().with(
+          polk::Range<3>({0, 0, 0}, {size, size, size})),
+      {1, 2, 3});
+  auto const count = KOKKOS_LAMBDA(std::size_t const i, std::size_t const j,
+                                   std::size_t const k) {
+    counts(i, j, k)++;
+  };
+
+  polk::parallel_for("interior", decomposition.getInterior(), count);
+  for (auto const &boundary : decomposition.getBoundaries()) {
+    polk::parallel_for("boundary", boundary, count);
+  }
+
+  auto countsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      for (int k = 0; k < size; k++) {
+        ASSERT_EQ(countsHost(i, j, k), 1);
+      }
+    }
+  }
+}
+
+TEST(test_halo, test_overlap_exchange) {
+  int constexpr size = 20;
+  Kokkos::View<int *> field("field", size + 2);
+  Kokkos::View<int *> result("result", size + 2);
+  auto decomposition = polk::decomposeHalo(
+      polk::ExecutionParameters().with(polk::Range(1, size + 1)), {1});
+  auto const stencil = KOKKOS_LAMBDA(std::size_t const i) {
+    result(i) = field(i - 1) + field(i + 1);
+  };
+  Kokkos::deep_copy(field, 1);
+
+  auto const instances = Kokkos::Experimental::partition_space(
+      Kokkos::DefaultExecutionSpace(), 1, 1);
+  polk::parallel_for("interior",
+                     decomposition.getInterior().replace(instances[0]),
+                     stencil);
+
+  // fake halo exchange
+  auto fieldHost = Kokkos::create_mirror_view(field);
+  Kokkos::deep_copy(fieldHost, field);
+  fieldHost(0) = 10;
+  fieldHost(size + 1) = 10;
+  Kokkos::deep_copy(field, fieldHost);
+
+  for (auto const &boundary : decomposition.getBoundaries()) {
+    polk::parallel_for("boundary", boundary.replace(instances[1]), stencil);
+  }
+  instances[0].fence();
+  instances[1].fence();
+
+  auto resultHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+  ASSERT_EQ(resultHost(1), 11);
+  ASSERT_EQ(resultHost(size / 2), 2);
+  ASSERT_EQ(resultHost(size), 11);
+}
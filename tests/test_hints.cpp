@@ -0,0 +1,77 @@
+#include <stdexcept>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/hints.hpp"
+#include "polk/parallel.hpp"
+
+TEST(test_hints, test_create) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::LaunchBounds<128, 2>())
+                        .with(polk::Occupancy(50));
+
+  ASSERT_TRUE(parameters.hasLaunchBounds());
+  ASSERT_TRUE(parameters.hasOccupancy());
+  ASSERT_EQ(parameters.getOccupancy().getPercent(), 50);
+  ASSERT_FALSE(polk::ExecutionParameters().hasLaunchBounds());
+  ASSERT_FALSE(polk::ExecutionParameters().hasOccupancy());
+}
+
+TEST(test_hints, test_invalid_occupancy) {
+  ASSERT_THROW(polk::Occupancy(0), std::invalid_argument);
+  ASSERT_THROW(polk::Occupancy(101), std::invalid_argument);
+}
+
+TEST(test_hints, test_get_policy_launch_bounds) {
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::Range<2>({0, 0}, {10, 10}))
+                    .with(polk::LaunchBounds<128, 2>())
+                    .getPolicy();
+
+  static_assert(std::is_same_v<typename decltype(policy)::launch_bounds,
+                               Kokkos::LaunchBounds<128, 2>>);
+
+  auto rangePolicy = polk::ExecutionParameters()
+                         .with(polk::Range(0, 10))
+                         .with(polk::LaunchBounds<256>())
+                         .getPolicy();
+
+  static_assert(std::is_same_v<typename decltype(rangePolicy)::launch_bounds,
+                               Kokkos::LaunchBounds<256, 0>>);
+
+  auto teamPolicy = polk::ExecutionParameters()
+                        .with(polk::League(10))
+                        .with(polk::LaunchBounds<64, 4>())
+                        .getPolicy();
+
+  static_assert(std::is_same_v<typename decltype(teamPolicy)::launch_bounds,
+                               Kokkos::LaunchBounds<64, 4>>);
+}
+
+TEST(test_hints, test_parallel_for) {
+  int constexpr size = 16;
+  Kokkos::View<int **> data("data", size, size);
+
+  polk::parallel_for(
+      "fill",
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {size, size}))
+          .with(polk::Tiling<2>({4, 4}))
+          .with(polk::TileOrder<polk::Morton>())
+          .with(polk::LaunchBounds<128>())
+          .with(polk::Occupancy(25)),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        data(i, j) = i + j;
+      });
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(dataHost(i, j), i + j);
+    }
+  }
+}
@@ -0,0 +1,115 @@
+#include <stdexcept>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/partition.hpp"
+
+TEST(test_partition, test_create) {
+  auto partition = polk::Partition<1>(std::vector<double>{1., 3.});
+
+  ASSERT_EQ(partition.getSize(), 2);
+  ASSERT_EQ(partition.getAxis(), 1);
+  ASSERT_EQ(partition.getWeights()[1], 3.);
+}
+
+TEST(test_partition, test_even) {
+  auto partition = polk::evenPartition(4);
+
+  ASSERT_EQ(partition.getSize(), 4);
+  ASSERT_EQ(partition.getAxis(), 0);
+  ASSERT_EQ(partition.getWeights()[3], 1.);
+}
+
+TEST(test_partition, test_invalid) {
+  ASSERT_THROW(polk::Partition(std::vector<double>{}), std::invalid_argument);
+  ASSERT_THROW(polk::Partition(std::vector<double>{1., -1.}),
+               std::invalid_argument);
+  ASSERT_THROW(polk::Partition(std::vector<double>{0., 0.}),
+               std::invalid_argument);
+}
+
+TEST(test_partition, test_split_range) {
+  auto ranges = polk::impl::splitRange<1>(polk::Range<2>({0, 10}, {5, 110}),
+                                          {1., 3.});
+
+  ASSERT_EQ(ranges.size(), 2);
+  ASSERT_EQ(ranges[0].getBegin()[0], 0);
+  ASSERT_EQ(ranges[0].getEnd()[0], 5);
+  ASSERT_EQ(ranges[0].getBegin()[1], 10);
+  ASSERT_EQ(ranges[0].getEnd()[1], 35);
+  ASSERT_EQ(ranges[1].getBegin()[1], 35);
+  ASSERT_EQ(ranges[1].getEnd()[1], 110);
+}
+
+TEST(test_partition, test_split_range_small) {
+  auto ranges =
+      polk::impl::splitRange<0>(polk::Range<1>(0, 2), {1., 1., 1., 1.});
+
+  ASSERT_EQ(ranges.size(), 4);
+  ASSERT_EQ(ranges.front().getBegin()[0], 0);
+  ASSERT_EQ(ranges.back().getEnd()[0], 2);
+  for (std::size_t i = 1; i < ranges.size(); i++) {
+    ASSERT_EQ(ranges[i].getBegin()[0], ranges[i - 1].getEnd()[0]);
+  }
+}
+
+TEST(test_partition, test_parallel_for) {
+  int constexpr size = 100;
+  Kokkos::View<int **> data("data", size, size);
+
+  auto instances = polk::parallel_for_partitioned(
+      "fill",
+      polk::ExecutionParameters().with(polk::Range<2>({0, 0}, {size, size})),
+      polk::Partition<1>(std::vector<double>{1., 2., 1.}),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        data(i, j) = i + j;
+      });
+  for (auto const &instance : instances) {
+    instance.fence();
+  }
+
+  ASSERT_EQ(instances.size(), 3);
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(dataHost(i, j), i + j);
+    }
+  }
+}
+
+TEST(test_partition, test_distinct_instances) {
+  Kokkos::DefaultExecutionSpace const space;
+
+  ASSERT_TRUE(polk::impl::areDistinctInstances(
+      std::vector<Kokkos::DefaultExecutionSpace>{space}));
+  ASSERT_FALSE(polk::impl::areDistinctInstances(
+      std::vector<Kokkos::DefaultExecutionSpace>{space, space}));
+}
+
+#ifdef KOKKOS_ENABLE_THREADS
+TEST(test_partition, test_parallel_for_threads) {
+  int constexpr size = 100;
+  Kokkos::View<int **, Kokkos::HostSpace> data("data", size, size);
+
+  auto instances = polk::parallel_for_partitioned(
+      "fill",
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {size, size}))
+          .with(Kokkos::Threads()),
+      polk::evenPartition<0>(4),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        data(i, j) = i + j;
+      });
+
+  ASSERT_EQ(instances.size(), 4);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(data(i, j), i + j);
+    }
+  }
+}
+#endif
@@ -0,0 +1,71 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/policy_cache.hpp"
+
+TEST(test_policy_cache, test_get_policy) {
+  auto const getParameters = [](std::size_t const size) {
+    return polk::ExecutionParameters()
+        .with(Kokkos::DefaultExecutionSpace())
+        .with(polk::Range<2>({0, 0}, {size, size}))
+        .with(polk::Tiling<2>({4, 4}));
+  };
+  polk::CachedPolicy<decltype(getParameters(0))> cache;
+
+  for (int step = 0; step < 10; step++) {
+    auto const &policy = cache.getPolicy("step", getParameters(10));
+
+    ASSERT_EQ(policy.m_upper[0], 10);
+  }
+
+  ASSERT_EQ(cache.getMissCount(), 1);
+
+  auto const &policy = cache.getPolicy("step", getParameters(20));
+
+  ASSERT_EQ(policy.m_upper[0], 20);
+  ASSERT_EQ(cache.getMissCount(), 2);
+
+  cache.getPolicy("other step", getParameters(20));
+
+  ASSERT_EQ(cache.getMissCount(), 3);
+
+  cache.clear();
+  cache.getPolicy("other step", getParameters(20));
+
+  ASSERT_EQ(cache.getMissCount(), 4);
+}
+
+TEST(test_policy_cache, test_get_policy_tile) {
+  auto const getParameters = [](std::size_t const tile) {
+    return polk::ExecutionParameters()
+        .with(polk::Range(0, 100))
+        .with(polk::Tiling(tile));
+  };
+  polk::CachedPolicy<decltype(getParameters(0))> cache;
+
+  cache.getPolicy("step", getParameters(10));
+  cache.getPolicy("step", getParameters(10));
+
+  ASSERT_EQ(cache.getMissCount(), 1);
+
+  cache.getPolicy("step", getParameters(20));
+
+  ASSERT_EQ(cache.getMissCount(), 2);
+}
+
+TEST(test_policy_cache, test_get_policy_strided) {
+  auto const getParameters = [](int const stride) {
+    return polk::ExecutionParameters().with(
+        polk::StridedRange(0, 100, stride));
+  };
+  polk::CachedPolicy<decltype(getParameters(1))> cache;
+
+  auto const &policy = cache.getPolicy("step", getParameters(2));
+
+  ASSERT_EQ(policy.end(), 50);
+
+  cache.getPolicy("step", getParameters(4));
+
+  ASSERT_EQ(cache.getMissCount(), 2);
+}
@@ -0,0 +1,137 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/profiling.hpp"
+#include "polk/tuning.hpp"
+#include "polk/vectorize.hpp"
+
+namespace {
+
+std::string getTemporaryOutputPath(std::string const &name) {
+  auto const path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove(path);
+  return path.string();
+}
+
+} // namespace
+
+TEST(test_profiling, test_summary) {
+  auto const path = getTemporaryOutputPath("polk_test_summary.csv");
+  polk::Profiler profiler(path);
+  profiler.record({"kernel", "Space", 2, {10, 20}, {2, 4}, 1.});
+  profiler.record({"kernel", "Space", 2, {10, 20}, {2, 4}, 3.});
+  profiler.record({"other \"kernel\"", "Space", 1, {10}, {}, 2.});
+  profiler.writeSummary();
+
+  std::ifstream file(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+
+  ASSERT_EQ(lines.size(), 3);
+  ASSERT_EQ(lines[0], "label,execution_space,rank,extents,tile,calls,total_s,"
+                      "min_s,max_s");
+  ASSERT_EQ(lines[1], "\"kernel\",Space,2,10x20,2x4,2,4,1,3");
+  ASSERT_EQ(lines[2], "\"other \"\"kernel\"\"\",Space,1,10,,1,2,2,2");
+}
+
+TEST(test_profiling, test_empty_summary) {
+  auto const path = getTemporaryOutputPath("polk_test_empty_summary.csv");
+  polk::Profiler profiler(path);
+  profiler.writeSummary();
+
+  ASSERT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(test_profiling, test_enable) {
+  auto &profiler = polk::Profiler::getInstance();
+  polk::Profiler other(getTemporaryOutputPath("polk_test_enable.csv"));
+
+  profiler.enable();
+  ASSERT_TRUE(polk::impl::isProfiling());
+  other.disable();
+  ASSERT_TRUE(polk::impl::isProfiling());
+  profiler.disable();
+  ASSERT_FALSE(polk::impl::isProfiling());
+  other.enable();
+  ASSERT_FALSE(polk::impl::isProfiling());
+  ASSERT_TRUE(other.isEnabled());
+}
+
+TEST(test_profiling, test_parallel_for) {
+  auto &profiler = polk::Profiler::getInstance();
+  std::vector<polk::KernelRecord> records;
+  profiler.setSink([&records](polk::KernelRecord const &kernelRecord) {
+    records.push_back(kernelRecord);
+  });
+
+  auto const parameters = polk::ExecutionParameters()
+                              .with(polk::Range<2>({0, 0}, {10, 20}))
+                              .with(polk::Tiling<2>({2, 4}));
+  auto const kernel = KOKKOS_LAMBDA(std::size_t const, std::size_t const){};
+
+  polk::parallel_for("disabled", parameters, kernel);
+  profiler.enable();
+  polk::parallel_for("enabled", parameters, kernel);
+  profiler.disable();
+  profiler.setSink({});
+
+  ASSERT_EQ(records.size(), 1);
+  ASSERT_EQ(records[0].mLabel, "enabled");
+  ASSERT_EQ(records[0].mExecutionSpace,
+            Kokkos::DefaultExecutionSpace::name());
+  ASSERT_EQ(records[0].mRank, 2);
+  ASSERT_EQ(records[0].mExtents, (std::vector<std::size_t>{10, 20}));
+  ASSERT_EQ(records[0].mTile, (std::vector<std::size_t>{2, 4}));
+  ASSERT_GE(records[0].mSeconds, 0);
+}
+
+TEST(test_profiling, test_parallel_for_launched_tile) {
+  auto &profiler = polk::Profiler::getInstance();
+  auto &cache = polk::TuningCache::getInstance();
+  auto const previousPath = cache.getPath();
+  cache.setPath(getTemporaryOutputPath("polk_test_profiling_tuning.txt"));
+  std::vector<polk::KernelRecord> records;
+  profiler.setSink([&records](polk::KernelRecord const &kernelRecord) {
+    records.push_back(kernelRecord);
+  });
+
+  auto const range = polk::Range<2>({0, 0}, {10, 20});
+  auto const kernel = KOKKOS_LAMBDA(std::size_t const, std::size_t const){};
+
+  profiler.enable();
+  polk::parallel_for(
+      "tuned",
+      polk::ExecutionParameters().with(range).with(polk::TunedTiling()),
+      kernel);
+  polk::parallel_for("vectorized",
+                     polk::ExecutionParameters()
+                         .with(range)
+                         .with(polk::Tiling<2>({2, 4}))
+                         .with(polk::Vectorize()),
+                     kernel);
+  profiler.disable();
+  profiler.setSink({});
+  cache.setPath(previousPath);
+
+  ASSERT_EQ(records.size(), 2);
+  ASSERT_EQ(records[0].mTile.size(), 2);
+  ASSERT_GE(records[0].mTile[0], 1);
+  ASSERT_GE(records[0].mTile[1], 1);
+
+  using Space = Kokkos::DefaultExecutionSpace;
+  if constexpr (Kokkos::SpaceAccessibility<Space,
+                                           Kokkos::HostSpace>::accessible) {
+    ASSERT_EQ(records[1].mTile, (std::vector<std::size_t>{2, 1}));
+  } else {
+    ASSERT_EQ(records[1].mTile, (std::vector<std::size_t>{2, 4}));
+  }
+}
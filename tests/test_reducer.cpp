@@ -0,0 +1,172 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/reducer.hpp"
+
+TEST(test_reducer, test_create) {
+  auto parameters =
+      polk::ExecutionParameters()
+          .with(polk::Range(0, 10))
+          .with(polk::Reducer<Kokkos::Sum<double>, Kokkos::Max<int>>());
+
+  ASSERT_TRUE(parameters.hasReducer());
+  ASSERT_EQ(parameters.getReducer().getSize(), 2);
+  ASSERT_FALSE(polk::ExecutionParameters().hasReducer());
+}
+
+TEST(test_reducer, test_reduction_chunk) {
+  ASSERT_EQ(polk::impl::getReductionChunk(100000, 10), 2500);
+  ASSERT_EQ(polk::impl::getReductionChunk(1000, 0), 250);
+  ASSERT_EQ(polk::impl::getReductionChunk(1000, 10),
+            polk::impl::reductionMinChunk);
+  ASSERT_EQ(polk::impl::getReductionChunk(3, 10),
+            polk::impl::reductionMinChunk);
+}
+
+TEST(test_reducer, test_reduce_policy) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::Range(0, 1000))
+                        .with(Kokkos::DefaultHostExecutionSpace());
+  auto policy = polk::impl::getReducePolicy(parameters);
+
+  ASSERT_EQ(policy.chunk_size(),
+            polk::impl::getReductionChunk(
+                1000, Kokkos::DefaultHostExecutionSpace().concurrency()));
+
+  auto tiledPolicy = polk::impl::getReducePolicy(
+      parameters.with(polk::Tiling(std::size_t(7))));
+
+  ASSERT_EQ(tiledPolicy.chunk_size(), 7);
+}
+
+TEST(test_reducer, test_parallel_reduce) {
+  int constexpr size = 100;
+  double sum = 0;
+
+  polk::parallel_reduce(
+      "sum", polk::ExecutionParameters().with(polk::Range(0, size)),
+      KOKKOS_LAMBDA(std::size_t const i, double &partial) { partial += i; },
+      sum);
+
+  ASSERT_EQ(sum, size * (size - 1) / 2);
+}
+
+TEST(test_reducer, test_parallel_reduce_fused) {
+  int constexpr size = 100;
+  Kokkos::View<double *> data("data", size);
+  polk::parallel_for(
+      "fill", polk::ExecutionParameters().with(polk::Range(0, size)),
+      KOKKOS_LAMBDA(std::size_t const i) { data(i) = (i - 40.) * (i - 40.); });
+
+  double sum = 0;
+  double max = 0;
+  Kokkos::MinLoc<double, int>::value_type minLoc;
+  polk::parallel_reduce(
+      "statistics",
+      polk::ExecutionParameters()
+          .with(polk::Range(0, size))
+          .with(polk::Reducer<Kokkos::Sum<double>, Kokkos::Max<double>,
+                              Kokkos::MinLoc<double, int>>()),
+      KOKKOS_LAMBDA(std::size_t const i, double &partialSum,
+                    double &partialMax,
+                    Kokkos::MinLoc<double, int>::value_type &partialMinLoc) {
+        partialSum += data(i);
+        if (data(i) > partialMax) {
+          partialMax = data(i);
+        }
+        if (data(i) < partialMinLoc.val) {
+          partialMinLoc.val = data(i);
+          partialMinLoc.loc = i;
+        }
+      },
+      sum, max, minLoc);
+
+  double expectedSum = 0;
+  for (int i = 0; i < size; i++) {
+    expectedSum += (i - 40.) * (i - 40.);
+  }
+  ASSERT_EQ(sum, expectedSum);
+  ASSERT_EQ(max, 59. * 59.);
+  ASSERT_EQ(minLoc.val, 0.);
+  ASSERT_EQ(minLoc.loc, 40);
+}
+
+TEST(test_reducer, test_parallel_reduce_2d) {
+  int constexpr size = 10;
+  int count = 0;
+
+  polk::parallel_reduce(
+      "count",
+      polk::ExecutionParameters().with(polk::Range<2>({0, 0}, {size, size})),
+      KOKKOS_LAMBDA(std::size_t const, std::size_t const, int &partial) {
+        partial++;
+      },
+      count);
+
+  ASSERT_EQ(count, size * size);
+}
+
+TEST(test_reducer, test_parallel_reduce_strided) {
+  int sum = 0;
+
+  polk::parallel_reduce(
+      "sum", polk::ExecutionParameters().with(polk::StridedRange(1, 10, 3)),
+      KOKKOS_LAMBDA(std::size_t const i, int &partial) { partial += i; }, sum);
+
+  ASSERT_EQ(sum, 1 + 4 + 7);
+}
+
+TEST(test_reducer, test_parallel_scan_strided) {
+  int constexpr size = 100;
+  Kokkos::View<long *> data("data", size);
+  long total = 0;
+  auto const kernel = KOKKOS_LAMBDA(std::size_t const i, long &partial,
+                                    bool const isFinal) {
+    partial += i;
+    if (isFinal) {
+      data(i) = partial;
+    }
+  };
+  auto const parameters =
+      polk::ExecutionParameters().with(polk::StridedRange(1, size, 3));
+
+  polk::parallel_scan("scan", parameters, kernel, total);
+
+  ASSERT_EQ(total, 1617);
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(1), 1);
+  ASSERT_EQ(dataHost(4), 1 + 4);
+  ASSERT_EQ(dataHost(97), total);
+
+  Kokkos::deep_copy(data, 0);
+  polk::parallel_scan("scan without total", parameters, kernel);
+
+  dataHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(7), 1 + 4 + 7);
+  ASSERT_EQ(dataHost(2), 0);
+}
+
+TEST(test_reducer, test_parallel_scan) {
+  int constexpr size = 100;
+  Kokkos::View<long *> data("data", size);
+  long total = 0;
+
+  polk::parallel_scan(
+      "scan", polk::ExecutionParameters().with(polk::Range(0, size)),
+      KOKKOS_LAMBDA(std::size_t const i, long &partial, bool const isFinal) {
+        partial += i;
+        if (isFinal) {
+          data(i) = partial;
+        }
+      },
+      total);
+
+  ASSERT_EQ(total, size * (size - 1) / 2);
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(size - 1), total);
+  ASSERT_EQ(dataHost(9), 45);
+}
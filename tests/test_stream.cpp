@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/stream.hpp"
+
+TEST(test_stream, test_create) {
+  auto streamed = polk::Streamed(16);
+
+  ASSERT_EQ(streamed.getChunkExtent(), 16);
+  ASSERT_EQ(polk::Streamed::getInstanceCount(), 2);
+  ASSERT_THROW(polk::Streamed(0), std::invalid_argument);
+}
+
+TEST(test_stream, test_chunk_range) {
+  auto ranges = polk::impl::chunkRange(polk::Range<2>({2, 0}, {12, 5}), 4);
+
+  ASSERT_EQ(ranges.size(), 3);
+  ASSERT_EQ(ranges[0].getBegin()[0], 2);
+  ASSERT_EQ(ranges[0].getEnd()[0], 6);
+  ASSERT_EQ(ranges[1].getBegin()[0], 6);
+  ASSERT_EQ(ranges[2].getEnd()[0], 12);
+  ASSERT_EQ(ranges[2].getBegin()[1], 0);
+  ASSERT_EQ(ranges[2].getEnd()[1], 5);
+
+  ASSERT_TRUE(polk::impl::chunkRange(polk::Range(5, 5), 4).empty());
+}
+
+TEST(test_stream, test_parallel_for) {
+  int constexpr size = 10;
+  int constexpr chunkExtent = 3;
+  std::size_t constexpr bufferCount = polk::Streamed::getInstanceCount();
+  Kokkos::View<int *> buffers("buffers", bufferCount * chunkExtent);
+  Kokkos::View<int **> data("data", size, 2);
+  std::vector<std::size_t> stagedChunks;
+
+  auto instances = polk::parallel_for_streamed(
+      "compute",
+      polk::ExecutionParameters().with(polk::Range<2>({0, 0}, {size, 2})),
+      polk::Streamed(chunkExtent),
+      [&](std::size_t const chunk, auto const &range, auto const &instance) {
+        stagedChunks.push_back(chunk);
+        int const begin = range.getBegin()[0];
+        int const offset = (chunk % bufferCount) * chunkExtent - begin;
+        polk::parallel_for(
+            "stage",
+            polk::ExecutionParameters().with(instance).with(
+                polk::Range(begin, range.getEnd()[0])),
+            KOKKOS_LAMBDA(int const i) { buffers(offset + i) = 10 * i; });
+      },
+      KOKKOS_LAMBDA(int const i, int const j) {
+        data(i, j) =
+            buffers((i / chunkExtent) % bufferCount * chunkExtent +
+                    i % chunkExtent) +
+            j;
+      });
+  for (auto const &instance : instances) {
+    instance.fence();
+  }
+
+  ASSERT_EQ(stagedChunks, (std::vector<std::size_t>{0, 1, 2, 3}));
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < 2; j++) {
+      ASSERT_EQ(dataHost(i, j), 10 * i + j);
+    }
+  }
+}
+
+#ifdef KOKKOS_ENABLE_THREADS
+TEST(test_stream, test_parallel_for_threads) {
+  int constexpr size = 10;
+  int constexpr chunkExtent = 3;
+  std::size_t constexpr bufferCount = polk::Streamed::getInstanceCount();
+  Kokkos::View<int *, Kokkos::HostSpace> buffers("buffers",
+                                                 bufferCount * chunkExtent);
+  Kokkos::View<int *, Kokkos::HostSpace> data("data", size);
+
+  polk::parallel_for_streamed(
+      "compute",
+      polk::ExecutionParameters()
+          .with(polk::Range(0, size))
+          .with(Kokkos::Threads()),
+      polk::Streamed(chunkExtent),
+      [&](std::size_t const chunk, auto const &range, auto const &instance) {
+        int const begin = range.getBegin()[0];
+        int const offset = (chunk % bufferCount) * chunkExtent - begin;
+        polk::parallel_for(
+            "stage",
+            polk::ExecutionParameters().with(instance).with(
+                polk::Range(begin, range.getEnd()[0])),
+            KOKKOS_LAMBDA(int const i) { buffers(offset + i) = 10 * i; });
+      },
+      KOKKOS_LAMBDA(int const i) {
+        data(i) = buffers((i / chunkExtent) % bufferCount * chunkExtent +
+                          i % chunkExtent);
+      });
+
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(data(i), 10 * i);
+  }
+}
+#endif
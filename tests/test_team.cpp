@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/team.hpp"
+
+TEST(test_team, test_create) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::League(10))
+                        .with(polk::TeamSize(4))
+                        .with(polk::VectorLength(Kokkos::AUTO))
+                        .with(polk::Scratch<0>(128, 8))
+                        .with(polk::Scratch<1>(1024));
+
+  ASSERT_TRUE(parameters.hasLeague());
+  ASSERT_TRUE(parameters.hasTeamSize());
+  ASSERT_TRUE(parameters.hasVectorLength());
+  ASSERT_TRUE(parameters.hasScratch<0>());
+  ASSERT_TRUE(parameters.hasScratch<1>());
+  ASSERT_FALSE(parameters.hasRange());
+  ASSERT_EQ(parameters.getLeague().getSize(), 10);
+  ASSERT_EQ(parameters.getTeamSize().getSize(), 4);
+  ASSERT_FALSE(parameters.getTeamSize().isAuto());
+  ASSERT_TRUE(parameters.getVectorLength().isAuto());
+  ASSERT_EQ(parameters.getScratch<0>().getPerTeam(), 128);
+  ASSERT_EQ(parameters.getScratch<0>().getPerThread(), 8);
+  ASSERT_EQ(parameters.getScratch<1>().getPerTeam(), 1024);
+  ASSERT_EQ(parameters.getScratch<1>().getPerThread(), 0);
+}
+
+TEST(test_team, test_create_league_out_of_bounds) {
+  std::size_t const maxSize = std::numeric_limits<int>::max();
+
+  ASSERT_EQ(polk::League(maxSize).getSize(), maxSize);
+  ASSERT_THROW(polk::League(maxSize + 1), std::invalid_argument);
+}
+
+TEST(test_team, test_default) {
+  auto parameters = polk::ExecutionParameters();
+
+  ASSERT_FALSE(parameters.hasLeague());
+  ASSERT_FALSE(parameters.hasTeamSize());
+  ASSERT_FALSE(parameters.hasVectorLength());
+  ASSERT_FALSE(parameters.hasScratch<0>());
+  ASSERT_FALSE(parameters.hasScratch<1>());
+}
+
+TEST(test_team, test_policy) {
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::League(10))
+                    .with(polk::TeamSize(4))
+                    .with(Kokkos::DefaultExecutionSpace())
+                    .getPolicy();
+
+  ASSERT_TRUE((std::is_same_v<
+               decltype(policy),
+               Kokkos::TeamPolicy<Kokkos::DefaultExecutionSpace>>));
+  ASSERT_EQ(policy.league_size(), 10);
+  ASSERT_EQ(policy.team_size(), 4);
+}
+
+TEST(test_team, test_policy_schedule) {
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::League(10))
+                    .with(polk::Schedule<Kokkos::Dynamic>())
+                    .getPolicy();
+
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(policy),
+                      Kokkos::TeamPolicy<Kokkos::Schedule<Kokkos::Dynamic>>>));
+  ASSERT_EQ(policy.league_size(), 10);
+}
+
+TEST(test_team, test_policy_scratch) {
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::League(10))
+                    .with(polk::TeamSize(2))
+                    .with(polk::Scratch<0>(128, 8))
+                    .with(polk::Scratch<1>(1024))
+                    .getPolicy();
+
+  ASSERT_EQ(policy.scratch_size(0), 128 + 2 * 8);
+  ASSERT_EQ(policy.scratch_size(1), 1024);
+}
+
+TEST(test_team, test_parallel_for) {
+  int constexpr leagueSize = 10;
+  int constexpr rowSize = 20;
+  Kokkos::View<int **> data("data", leagueSize, rowSize);
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::League(leagueSize))
+                    .with(polk::TeamSize(Kokkos::AUTO))
+                    .getPolicy();
+  using Member = decltype(policy)::member_type;
+
+  Kokkos::parallel_for(
+      "fill", policy, KOKKOS_LAMBDA(Member const &member) {
+        int const i = member.league_rank();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member, rowSize),
+                             [&](int const j) { data(i, j) = i + j; });
+      });
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < leagueSize; i++) {
+    for (int j = 0; j < rowSize; j++) {
+      ASSERT_EQ(dataHost(i, j), i + j);
+    }
+  }
+}
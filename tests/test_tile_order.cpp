@@ -0,0 +1,155 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/tile_order.hpp"
+
+TEST(test_tile_order, test_with_tile_order) {
+  auto myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {10, 10}))
+          .with(polk::TileOrder<polk::Morton>());
+
+  static_assert(myExecutionParameters.hasTileOrder());
+  static_assert(
+      std::is_same_v<decltype(myExecutionParameters.getTileOrder()),
+                     polk::TileOrder<polk::Morton>>);
+}
+
+TEST(test_tile_order, test_decode_morton) {
+  Kokkos::Array<int, 2> const bits = {2, 1};
+
+  auto coordinates = polk::impl::decodeMorton<2>(0b111, bits, true);
+  ASSERT_EQ(coordinates[0], 0b11);
+  ASSERT_EQ(coordinates[1], 0b1);
+
+  coordinates = polk::impl::decodeMorton<2>(0b101, bits, false);
+  ASSERT_EQ(coordinates[0], 0b10);
+  ASSERT_EQ(coordinates[1], 0b1);
+}
+
+TEST(test_tile_order, test_decode_hilbert) {
+  std::size_t constexpr side = 8;
+  std::set<std::pair<std::size_t, std::size_t>> visited;
+
+  auto previous = polk::impl::decodeHilbert(0, side);
+  ASSERT_EQ(previous[0], 0);
+  ASSERT_EQ(previous[1], 0);
+  visited.insert({previous[0], previous[1]});
+  for (std::size_t code = 1; code < side * side; code++) {
+    auto const current = polk::impl::decodeHilbert(code, side);
+    ASSERT_LT(current[0], side);
+    ASSERT_LT(current[1], side);
+    ASSERT_EQ(std::labs(long(current[0]) - long(previous[0])) +
+                  std::labs(long(current[1]) - long(previous[1])),
+              1);
+    visited.insert({current[0], current[1]});
+    previous = current;
+  }
+
+  ASSERT_EQ(visited.size(), side * side);
+}
+
+TEST(test_tile_order, test_encode) {
+  Kokkos::Array<int, 3> const bits = {3, 1, 2};
+  for (std::size_t code = 0; code < 64; code++) {
+    for (bool const isInnerLeft : {true, false}) {
+      auto const coordinates =
+          polk::impl::decodeMorton<3>(code, bits, isInnerLeft);
+      ASSERT_EQ(polk::impl::encodeMorton<3>(coordinates, bits, isInnerLeft),
+                code);
+    }
+  }
+
+  std::size_t constexpr side = 16;
+  for (std::size_t code = 0; code < side * side; code++) {
+    auto const coordinates = polk::impl::decodeHilbert(code, side);
+    ASSERT_EQ(polk::impl::encodeHilbert(coordinates[0], coordinates[1], side),
+              code);
+  }
+}
+
+TEST(test_tile_order, test_length) {
+  using Hilbert = polk::impl::TileOrdering<polk::Hilbert, 2, Kokkos::HostSpace>;
+  using Morton = polk::impl::TileOrdering<polk::Morton, 2, Kokkos::HostSpace>;
+  Kokkos::DefaultHostExecutionSpace const space;
+
+  ASSERT_EQ(Hilbert(space, {4096, 8}, {4, 4}, false).getLength(), 2048);
+  ASSERT_EQ(Morton(space, {1026, 3}, {2, 1}, false).getLength(), 513 * 3);
+  ASSERT_EQ(Morton(space, {0, 3}, {2, 1}, false).getLength(), 0);
+}
+
+TEST(test_tile_order, test_codes_cache) {
+  using Morton = polk::impl::TileOrdering<polk::Morton, 2, Kokkos::HostSpace>;
+  Kokkos::DefaultHostExecutionSpace const space;
+
+  Morton const ordering(space, {100, 30}, {10, 10}, false);
+  Morton const sameCounts(space, {95, 21}, {10, 8}, false);
+  Morton const otherCounts(space, {100, 30}, {10, 5}, false);
+
+  ASSERT_EQ(sameCounts.mCodes.data(), ordering.mCodes.data());
+  ASSERT_NE(otherCounts.mCodes.data(), ordering.mCodes.data());
+  ASSERT_EQ(otherCounts.getLength(), 60);
+}
+
+TEST(test_tile_order, test_tile_policy_index_type) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::Range<2, std::int32_t>({0, 0}, {10, 10}))
+                        .with(polk::Tiling<2>({4, 4}))
+                        .with(polk::TileOrder<polk::Morton>());
+  using Policy = decltype(polk::impl::getTilePolicy(parameters, 9));
+
+  static_assert(std::is_same_v<typename Policy::index_type, std::int32_t>);
+}
+
+TEST(test_tile_order_integration, test_morton) {
+  Kokkos::View<int ***> data("data", 13, 7, 21);
+
+  polk::parallel_for(
+      "count", polk::ExecutionParameters()
+                   .with(polk::Range<3>({1, 0, 2}, {13, 7, 21}))
+                   .with(polk::Tiling<3>({4, 2, 8}))
+                   .with(polk::TileOrder<polk::Morton>()),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j,
+                    std::size_t const k) { data(i, j, k) += 1; });
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < 13; i++) {
+    for (int j = 0; j < 7; j++) {
+      for (int k = 0; k < 21; k++) {
+        ASSERT_EQ(dataHost(i, j, k), i >= 1 && k >= 2 ? 1 : 0);
+      }
+    }
+  }
+}
+
+TEST(test_tile_order_integration, test_hilbert) {
+  Kokkos::View<int **> data("data", 30, 9);
+
+  polk::parallel_for(
+      "count", polk::ExecutionParameters()
+                   .with(polk::Range<2>({0, 0}, {30, 9}))
+                   .with(polk::Tiling<2>({4, 4}))
+                   .with(polk::Iterate<Kokkos::Iterate::Left>())
+                   .with(polk::TileOrder<polk::Hilbert>()),
+      KOKKOS_LAMBDA(std::size_t const i, std::size_t const j) {
+        data(i, j) += 1;
+      });
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < 30; i++) {
+    for (int j = 0; j < 9; j++) {
+      ASSERT_EQ(dataHost(i, j), 1);
+    }
+  }
+}
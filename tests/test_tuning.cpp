@@ -0,0 +1,193 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/tuning.hpp"
+
+std::string getTemporaryCachePath(std::string const &name) {
+  auto const path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove(path);
+  return path.string();
+}
+
+TEST(test_tuning, test_candidates) {
+  auto candidates =
+      polk::impl::getTuningCandidates<2>({100, 8}, false, true);
+
+  ASSERT_FALSE(candidates.empty());
+  for (auto const &tile : candidates) {
+    ASSERT_EQ(tile.size(), 2);
+    ASSERT_GE(tile[0], 1);
+    ASSERT_LE(tile[0], 100);
+    ASSERT_GE(tile[1], 1);
+    ASSERT_LE(tile[1], 8);
+  }
+}
+
+TEST(test_tuning, test_candidates_device) {
+  auto candidates =
+      polk::impl::getTuningCandidates<3>({512, 512, 512}, false, false);
+
+  ASSERT_FALSE(candidates.empty());
+  for (auto const &tile : candidates) {
+    ASSERT_LE(tile[0] * tile[1] * tile[2], 256);
+  }
+}
+
+TEST(test_tuning, test_key) {
+  auto key = polk::impl::getTuningKey<2>("my\tkernel", "Serial", {10, 20});
+
+  ASSERT_EQ(key, "my kernel [Serial] 10x20");
+}
+
+TEST(test_tuning_cache, test_session) {
+  polk::TuningCache cache(getTemporaryCachePath("polk_test_session.txt"));
+  std::vector<std::vector<std::size_t>> const candidates = {{1}, {2}, {3}};
+  std::vector<double> const times = {0, 3., 1., 2.};
+
+  for (auto const time : times) {
+    ASSERT_FALSE(cache.find("kernel", 1));
+    auto trial = cache.startTrial("kernel", candidates);
+    cache.endTrial("kernel", trial, time);
+  }
+
+  auto tile = cache.find("kernel", 1);
+  ASSERT_TRUE(tile);
+  ASSERT_EQ(*tile, std::vector<std::size_t>{2});
+  ASSERT_FALSE(cache.isTuning("kernel"));
+}
+
+TEST(test_tuning_cache, test_persistence) {
+  auto const path = getTemporaryCachePath("polk_test_persistence.txt");
+
+  {
+    polk::TuningCache cache(path);
+    cache.insert("kernel a [Serial] 10x10", {2, 5});
+    cache.insert("kernel b [Serial] 100", {64});
+  }
+
+  polk::TuningCache cache(path);
+  auto tileA = cache.find("kernel a [Serial] 10x10", 2);
+  auto tileB = cache.find("kernel b [Serial] 100", 1);
+
+  ASSERT_TRUE(tileA);
+  ASSERT_EQ(*tileA, (std::vector<std::size_t>{2, 5}));
+  ASSERT_TRUE(tileB);
+  ASSERT_EQ(*tileB, std::vector<std::size_t>{64});
+  ASSERT_FALSE(cache.find("kernel c [Serial] 100", 1));
+}
+
+TEST(test_tuning_cache, test_concurrent_save) {
+  auto const path = getTemporaryCachePath("polk_test_concurrent_save.txt");
+  polk::TuningCache cacheA(path);
+  polk::TuningCache cacheB(path);
+
+  cacheA.insert("kernel a [Serial] 10", {2});
+  cacheB.insert("kernel b [Serial] 10", {5});
+
+  auto tile = polk::TuningCache(path).find("kernel b [Serial] 10", 1);
+  ASSERT_TRUE(tile);
+  ASSERT_EQ(*tile, std::vector<std::size_t>{5});
+
+  auto const directory = std::filesystem::path(path).parent_path();
+  auto const prefix = std::filesystem::path(path).filename().string() + ".";
+  for (auto const &entry : std::filesystem::directory_iterator(directory)) {
+    ASSERT_NE(entry.path().filename().string().rfind(prefix, 0), 0);
+  }
+}
+
+TEST(test_tuning_cache, test_invalid_tile) {
+  auto const path = getTemporaryCachePath("polk_test_invalid_tile.txt");
+
+  {
+    std::ofstream file(path);
+    file << "kernel a [Serial] 10x10\t2 5 7\n";
+    file << "kernel b [Serial] 10x10\t0 5\n";
+    file << "kernel c [Serial] 10x10\t2 5\n";
+  }
+
+  polk::TuningCache cache(path);
+
+  ASSERT_FALSE(cache.find("kernel a [Serial] 10x10", 2));
+  ASSERT_FALSE(cache.find("kernel b [Serial] 10x10", 2));
+  ASSERT_TRUE(cache.find("kernel c [Serial] 10x10", 2));
+  ASSERT_FALSE(cache.find("kernel c [Serial] 10x10", 3));
+
+  cache.insert("kernel d [Serial] 10", {0});
+  ASSERT_FALSE(cache.find("kernel d [Serial] 10", 1));
+}
+
+TEST(test_execution_policy_creator, test_with_tuned_tiling) {
+  auto myExecutionParameters = polk::ExecutionParameters()
+                                   .with(polk::Range<2>({0, 0}, {10, 10}))
+                                   .with(polk::TunedTiling());
+  auto policy = myExecutionParameters.getPolicy();
+
+  static_assert(myExecutionParameters.hasTiling());
+  static_assert(myExecutionParameters.getRank() == 2);
+
+  ASSERT_EQ(policy.m_upper[0], 10);
+  ASSERT_EQ(policy.m_upper[1], 10);
+}
+
+TEST(test_execution_policy_creator, test_replace_tiling) {
+  auto myExecutionParameters = polk::ExecutionParameters()
+                                   .with(polk::Range<2>({0, 0}, {100, 100}))
+                                   .with(polk::Tiling<2>({10, 10}))
+                                   .replace(polk::Tiling<2>({20, 5}));
+  auto policy = myExecutionParameters.getPolicy();
+
+  ASSERT_EQ(policy.m_tile[0], 20);
+  ASSERT_EQ(policy.m_tile[1], 5);
+}
+
+struct DummyKernelIncrement2D {
+  Kokkos::View<int **> mData;
+
+  DummyKernelIncrement2D(Kokkos::View<int **> data) : mData(data) {}
+
+  KOKKOS_FUNCTION
+  void operator()(int const i, int const j) const { mData(i, j) += 1; }
+};
+
+TEST(test_parallel_for, test_tuned_tiling) {
+  auto &cache = polk::TuningCache::getInstance();
+  auto const previousPath = cache.getPath();
+  auto const path = getTemporaryCachePath("polk_test_parallel_for.txt");
+  cache.setPath(path);
+
+  Kokkos::View<int **> data("data", 50, 60);
+  auto const myExecutionParameters =
+      polk::ExecutionParameters()
+          .with(polk::Range<2>({0, 0}, {50, 60}))
+          .with(polk::TunedTiling())
+          .with(Kokkos::DefaultExecutionSpace());
+  auto const key = polk::impl::getTuningKey<2>(
+      "tuned kernel", Kokkos::DefaultExecutionSpace::name(), {50, 60});
+
+  int launches = 0;
+  while (launches < 100 && !cache.find(key, 2)) {
+    polk::parallel_for("tuned kernel", myExecutionParameters,
+                       DummyKernelIncrement2D(data));
+    launches++;
+  }
+  polk::parallel_for("tuned kernel", myExecutionParameters,
+                     DummyKernelIncrement2D(data));
+  launches++;
+
+  auto dataMirror =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+
+  ASSERT_LT(launches, 100);
+  ASSERT_EQ(dataMirror(0, 0), launches);
+  ASSERT_EQ(dataMirror(49, 59), launches);
+  ASSERT_EQ(polk::TuningCache(path).find(key, 2), cache.find(key, 2));
+
+  cache.setPath(previousPath);
+}
@@ -0,0 +1,129 @@
+#include <cstdint>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/vectorize.hpp"
+
+namespace {
+
+struct Fill {};
+
+template <typename Parameters>
+void checkTriad(Parameters const &parameters, int const size) {
+  Kokkos::View<double ***> a("a", size, size, size);
+  Kokkos::View<double ***> b("b", size, size, size);
+  Kokkos::View<int ***> count("count", size, size, size);
+
+  Kokkos::deep_copy(b, 2.);
+  polk::parallel_for(
+      "triad", parameters,
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                    std::int64_t const k) {
+        a(i, j, k) = b(i, j, k) + 3. * (i + j + k);
+        count(i, j, k)++;
+      });
+
+  auto aHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto countHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), count);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      for (int k = 0; k < size; k++) {
+        ASSERT_EQ(aHost(i, j, k), 2. + 3. * (i + j + k));
+        ASSERT_EQ(countHost(i, j, k), 1);
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(test_vectorize, test_create) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::Range<2>({0, 0}, {10, 10}))
+                        .with(polk::Vectorize());
+
+  ASSERT_TRUE(parameters.hasVectorize());
+  ASSERT_FALSE(polk::ExecutionParameters().hasVectorize());
+
+  using Parameters = decltype(parameters);
+  using Space = typename decltype(parameters.getPolicy())::execution_space;
+
+  ASSERT_EQ(polk::impl::isVectorized<Parameters>(),
+            (Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible));
+  ASSERT_FALSE(polk::impl::isVectorized<decltype(
+                   polk::ExecutionParameters()
+                       .with(polk::Range(0, 10))
+                       .with(polk::Vectorize()))>());
+}
+
+TEST(test_vectorize, test_parallel_for) {
+  int constexpr size = 10;
+
+  checkTriad(polk::ExecutionParameters()
+                 .with(polk::Range<3>({0, 0, 0}, {size, size, size}))
+                 .with(polk::Vectorize()),
+             size);
+}
+
+TEST(test_vectorize, test_parallel_for_tiling) {
+  int constexpr size = 10;
+
+  checkTriad(polk::ExecutionParameters()
+                 .with(polk::Range<3>({0, 0, 0}, {size, size, size}))
+                 .with(polk::Tiling<3>({2, 4, 4}))
+                 .with(polk::Vectorize()),
+             size);
+}
+
+TEST(test_vectorize, test_parallel_for_left) {
+  int constexpr size = 10;
+
+  checkTriad(polk::ExecutionParameters()
+                 .with(polk::Range<3>({0, 0, 0}, {size, size, size}))
+                 .with(polk::Iterate<Kokkos::Iterate::Left>())
+                 .with(polk::Vectorize()),
+             size);
+}
+
+TEST(test_vectorize, test_parallel_for_tile_order) {
+  int constexpr size = 10;
+
+  checkTriad(polk::ExecutionParameters()
+                 .with(polk::Range<3>({0, 0, 0}, {size, size, size}))
+                 .with(polk::Tiling<3>({4, 4, 4}))
+                 .with(polk::TileOrder<polk::Morton>())
+                 .with(polk::Vectorize()),
+             size);
+}
+
+TEST(test_vectorize, test_parallel_for_work_tag) {
+  int constexpr size = 8;
+  Kokkos::View<int **> data("data", size, size);
+
+  struct Functor {
+    Kokkos::View<int **> mData;
+
+    KOKKOS_FUNCTION void operator()(Fill, int const i, int const j) const {
+      mData(i, j) = i * j;
+    }
+  };
+
+  polk::parallel_for("fill",
+                     polk::ExecutionParameters()
+                         .with(polk::Range<2>({1, 2}, {size, size}))
+                         .with(polk::WorkTag<Fill>())
+                         .with(polk::Vectorize()),
+                     Functor{data});
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(3, 5), 15);
+  ASSERT_EQ(dataHost(1, 7), 7);
+  ASSERT_EQ(dataHost(1, 1), 0);
+  ASSERT_EQ(dataHost(0, 3), 0);
+}
@@ -0,0 +1,157 @@
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/weighted_range.hpp"
+
+namespace {
+
+struct Fill {};
+
+Kokkos::View<int *> createCosts(int const size) {
+  Kokkos::View<int *> costs("costs", size);
+  auto costsHost = Kokkos::create_mirror_view(costs);
+  for (int i = 0; i < size; i++) {
+    // a few expensive indices at the beginning
+    costsHost(i) = i < 4 ? 100 : 1;
+  }
+  Kokkos::deep_copy(costs, costsHost);
+
+  return costs;
+}
+
+} // namespace
+
+TEST(test_weighted_range, test_create) {
+  auto range = polk::WeightedRange(createCosts(100), 4);
+
+  static_assert(polk::WeightedRangeType<decltype(range)>);
+  static_assert(polk::CompactedRangeType<decltype(range)>);
+  static_assert(!polk::WeightedRangeType<polk::Range<1>>);
+  ASSERT_EQ(range.getRank(), 1);
+  ASSERT_EQ(range.getEnd()[0], 100);
+  ASSERT_EQ(range.getChunkCount(), 4);
+
+  // total cost of 496, 124 per chunk
+  auto bounds = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    range.getBounds());
+  ASSERT_EQ(bounds(0), 0);
+  ASSERT_EQ(bounds(1), 2);
+  ASSERT_EQ(bounds(2), 3);
+  ASSERT_EQ(bounds(3), 4);
+  ASSERT_EQ(bounds(4), 100);
+
+  ASSERT_EQ(range.getCompactRange().getEnd()[0], 4);
+}
+
+TEST(test_weighted_range, test_create_small) {
+  ASSERT_EQ(polk::WeightedRange(createCosts(3), 10).getChunkCount(), 3);
+  ASSERT_EQ(polk::WeightedRange(createCosts(0), 10).getChunkCount(), 1);
+  ASSERT_GE(polk::WeightedRange(createCosts(100)).getChunkCount(), 1);
+}
+
+TEST(test_weighted_range, test_create_negative) {
+  auto costs = createCosts(10);
+  auto costsHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), costs);
+  costsHost(5) = -1;
+  Kokkos::deep_copy(costs, costsHost);
+
+  ASSERT_THROW(polk::WeightedRange(costs, 2), std::invalid_argument);
+}
+
+TEST(test_weighted_range, test_get_policy) {
+  auto policy = polk::ExecutionParameters()
+                    .with(polk::WeightedRange(createCosts(100), 8))
+                    .getPolicy();
+
+  ASSERT_EQ(policy.begin(), 0);
+  ASSERT_EQ(policy.end(), 8);
+}
+
+TEST(test_weighted_range, test_parallel_for) {
+  int constexpr size = 100;
+  Kokkos::View<int *> data("data", size);
+
+  polk::parallel_for(
+      "fill",
+      polk::ExecutionParameters().with(
+          polk::WeightedRange(createCosts(size), 7)),
+      KOKKOS_LAMBDA(std::size_t const i) { data(i) += i; });
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < size; i++) {
+    ASSERT_EQ(dataHost(i), i);
+  }
+}
+
+TEST(test_weighted_range, test_parallel_for_work_tag) {
+  int constexpr size = 10;
+  Kokkos::View<int *> data("data", size);
+
+  struct Functor {
+    Kokkos::View<int *> mData;
+
+    KOKKOS_FUNCTION void operator()(Fill, std::size_t const i) const {
+      mData(i) = 2 * i;
+    }
+  };
+
+  polk::parallel_for("fill",
+                     polk::ExecutionParameters()
+                         .with(polk::WeightedRange(createCosts(size), 3))
+                         .with(polk::WorkTag<Fill>()),
+                     Functor{data});
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(9), 18);
+}
+
+TEST(test_weighted_range, test_parallel_reduce) {
+  int constexpr size = 100;
+  int sum = 0;
+
+  polk::parallel_reduce(
+      "sum",
+      polk::ExecutionParameters().with(
+          polk::WeightedRange(createCosts(size), 5)),
+      KOKKOS_LAMBDA(std::size_t const i, int &partial) { partial += i; },
+      sum);
+
+  ASSERT_EQ(sum, size * (size - 1) / 2);
+}
+
+TEST(test_weighted_range, test_parallel_scan) {
+  int constexpr size = 100;
+  Kokkos::View<long *> data("data", size);
+  long total = 0;
+  auto const kernel = KOKKOS_LAMBDA(std::size_t const i, long &partial,
+                                    bool const isFinal) {
+    partial += i;
+    if (isFinal) {
+      data(i) = partial;
+    }
+  };
+  auto const parameters = polk::ExecutionParameters().with(
+      polk::WeightedRange(createCosts(size), 6));
+
+  polk::parallel_scan("scan", parameters, kernel, total);
+
+  ASSERT_EQ(total, size * (size - 1) / 2);
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(9), 45);
+  ASSERT_EQ(dataHost(size - 1), total);
+
+  Kokkos::deep_copy(data, 0);
+  polk::parallel_scan("scan without total", parameters, kernel);
+
+  dataHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  ASSERT_EQ(dataHost(9), 45);
+  ASSERT_EQ(dataHost(size - 1), size * (size - 1) / 2);
+}
@@ -0,0 +1,120 @@
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "polk/execution_policy_creator.hpp"
+#include "polk/parallel.hpp"
+#include "polk/work_tag.hpp"
+
+namespace {
+
+struct Fill {};
+struct Double {};
+
+struct Phases {
+  Kokkos::View<int **> mData;
+
+  KOKKOS_FUNCTION void operator()(Fill, std::size_t const i,
+                                  std::size_t const j) const {
+    mData(i, j) = i + j;
+  }
+
+  KOKKOS_FUNCTION void operator()(Double, std::size_t const i,
+                                  std::size_t const j) const {
+    mData(i, j) *= 2;
+  }
+
+  KOKKOS_FUNCTION void operator()(Fill, std::size_t const i,
+                                  int &partial) const {
+    partial += i;
+  }
+};
+
+template <typename Parameters>
+void checkPhases(Parameters const &parameters, int const size) {
+  Phases const phases{Kokkos::View<int **>("data", size, size)};
+
+  polk::parallel_for("fill", parameters.with(polk::WorkTag<Fill>()), phases);
+  polk::parallel_for("double", parameters.with(polk::WorkTag<Fill>())
+                                   .replace(polk::WorkTag<Double>()),
+                     phases);
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), phases.mData);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      ASSERT_EQ(dataHost(i, j), 2 * (i + j));
+    }
+  }
+}
+
+} // namespace
+
+TEST(test_work_tag, test_create) {
+  auto parameters = polk::ExecutionParameters()
+                        .with(polk::Range<2>({0, 0}, {10, 10}))
+                        .with(polk::WorkTag<Fill>());
+
+  ASSERT_TRUE(parameters.hasWorkTag());
+  ASSERT_FALSE(polk::ExecutionParameters().hasWorkTag());
+
+  auto policy = parameters.getPolicy();
+
+  static_assert(std::is_same_v<typename decltype(policy)::work_tag, Fill>);
+
+  auto retaggedPolicy =
+      parameters.replace(polk::WorkTag<Double>()).getPolicy();
+
+  static_assert(
+      std::is_same_v<typename decltype(retaggedPolicy)::work_tag, Double>);
+  ASSERT_EQ(retaggedPolicy.m_upper[1], 10);
+}
+
+TEST(test_work_tag, test_parallel_for) {
+  int constexpr size = 10;
+
+  checkPhases(polk::ExecutionParameters().with(
+                  polk::Range<2>({0, 0}, {size, size})),
+              size);
+}
+
+TEST(test_work_tag, test_parallel_for_tile_order) {
+  int constexpr size = 10;
+
+  checkPhases(polk::ExecutionParameters()
+                  .with(polk::Range<2>({0, 0}, {size, size}))
+                  .with(polk::Tiling<2>({4, 4}))
+                  .with(polk::TileOrder<polk::Morton>()),
+              size);
+}
+
+TEST(test_work_tag, test_parallel_for_strided) {
+  int constexpr size = 10;
+  Phases const phases{Kokkos::View<int **>("data", size, size)};
+
+  polk::parallel_for(
+      "fill",
+      polk::ExecutionParameters()
+          .with(polk::StridedRange<2>({0, 1}, {size, size}, {1, 2}))
+          .with(polk::WorkTag<Fill>()),
+      phases);
+
+  auto dataHost =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), phases.mData);
+  ASSERT_EQ(dataHost(3, 1), 4);
+  ASSERT_EQ(dataHost(3, 2), 0);
+}
+
+TEST(test_work_tag, test_parallel_reduce) {
+  Phases const phases{Kokkos::View<int **>("data", 1, 1)};
+  int sum = 0;
+
+  polk::parallel_reduce("sum",
+                        polk::ExecutionParameters()
+                            .with(polk::Range(0, 10))
+                            .with(polk::WorkTag<Fill>()),
+                        phases, sum);
+
+  ASSERT_EQ(sum, 45);
+}